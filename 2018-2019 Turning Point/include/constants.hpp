@@ -13,8 +13,23 @@
 #define SD_INSERTED true
 
 
-// How long to wait for a mutex to be released
-#define MUTEX_WAIT_TIME 1000 // in ms
+// How often the drive task issues the latest drive command
+#define DRIVE_TASK_INTERVAL 10 // in ms
+
+// How long to wait for the drive task to zero the drive motors
+#define DRIVE_TARE_TIMEOUT 100 // in ms
+
+// How long a pivot using the gyro may run before it gives up
+#define PIVOT_GYRO_TIMEOUT 3000 // in ms
+
+// Whether to run the USB debugger, which also runs in competition
+#define DEBUGGER_ENABLED true
+
+// Priority of the USB debugger task, below every control task
+#define DEBUGGER_TASK_PRIORITY (TASK_PRIORITY_MIN + 1)
+
+// How often the USB debugger reads the serial input
+#define DEBUGGER_POLL_INTERVAL 50 // in ms
 
 // Whether, by default, to brake the motors
 #define MOTOR_DEFAULT_BRAKE true
@@ -31,10 +46,41 @@
 // Proportional constant for move relative
 #define MOTOR_MOVE_RELATIVE_KP .43
 
+// Voltage added to every drive motor while strafing until the strafe compensation table is calibrated
+#define STRAFE_DEFAULT_COMPENSATION 20
+
+// Voltage and time to drive at for each strafe calibration measurement
+#define STRAFE_CALIBRATION_VOLTAGE 40
+#define STRAFE_CALIBRATION_TIME 1000 // in ms
+
+// Strafe compensation table path
+#define STRAFE_TABLE_PATH "/usd/strafe.txt"
+
+// Tunables file path, and whether to apply the saved tunables on start
+#define TUNABLES_PATH "/usd/tunables.txt"
+#define TUNABLES_LOAD_SAVED false
+
+// Cross-coupling constant keeping PID controlled motors in step
+#define PID_SYNC_KP .2 // in power per degree
+
 
 // Default logs path
 #define LOGS_PATH "/usd/logs/"
 
+// The two copies of the numbered logs index
+#define LOGS_INDEX_PATH_A "/usd/logs/index0.txt"
+#define LOGS_INDEX_PATH_B "/usd/logs/index1.txt"
+
+// Size at which the numbered log is rotated
+#define LOGS_ROTATE_SIZE 262144 // in bytes
+
+// Most numbered logs, and most total size of them, to keep on the microSD card
+#define LOGS_MAX_COUNT 100
+#define LOGS_MAX_SIZE 16777216 // in bytes
+
+// Numbered logs wrap around after this number, keeping 3 digit names
+#define LOGS_NUMBER_LIMIT 1000
+
 // Default minimum logging level
 #define LOGGING_DEFAULT_LEVEL E_LOGGING_INFO
 
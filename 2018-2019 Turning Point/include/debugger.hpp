@@ -0,0 +1,105 @@
+#ifndef _DEBUGGER_HPP_
+#define _DEBUGGER_HPP_
+
+#include "main.h"
+#include "pros/apix.h"
+
+/*
+ * A class to handle serial debugging through USB with a computer
+ * Interfaces with 'pros terminal' and queries motors, controllers, and batteries
+ *
+ * PROS 3.1.6 cannot report how many characters are waiting on the serial input, as FIONREAD is not supported on
+ * stdin, so a read of the serial input always blocks until a character arrives. That blocking read is isolated in
+ * a reader task, which only passes each character into a queue. The debugger task polls the queue without
+ * blocking and sleeps between polls, and both run at a low priority, so neither delays the drive or competition
+ * tasks. Commands are looked up in a fixed table and responses are formatted into a fixed buffer, so handling a
+ * command does not allocate
+ */
+
+class Debugger {
+  public:
+    // The longest command line accepted, longer lines are discarded
+    static const int LINE_LENGTH = 64;
+
+    // The longest response line written
+    static const int RESPONSE_LENGTH = 128;
+
+    // The most arguments passed to a command, including its name
+    static const int MAX_ARGUMENTS = 4;
+
+  private:
+    // A command in the command table, its handler given the arguments including the name
+    struct Command {
+      const char * name;
+      const char * usage;
+      void (*handler)(int argc, char ** argv);
+    };
+
+    // The command table
+    static const Command commands[];
+    static const int COMMAND_COUNT;
+
+    // The longest amount of received characters waiting to be handled, further characters are dropped
+    static const int INPUT_LENGTH = 128;
+
+    // The debugger task and the reader task, NULL if stopped
+    static pros::Task * task;
+    static pros::Task * reader;
+
+    // The characters received by the reader task, waiting to be handled
+    static pros::c::queue_t input;
+
+    // The command line being typed, and how many characters of it have been received
+    static char line[LINE_LENGTH];
+    static int length;
+    // Whether the current line overflowed and should be discarded
+    static bool overflow;
+
+    // The buffer every response is formatted in
+    static char response[RESPONSE_LENGTH];
+
+    // Handles a complete command line, splitting it in place into arguments
+    static void execute(char * line);
+
+    // Formats a line of response and writes it to the serial output
+    static void respond(const char * format, ...);
+
+    // Parses the argument as a port, responding and returning 0 if it is not one
+    static int parsePort(const char * argument);
+
+    // The command handlers
+    static void help(int argc, char ** argv);
+    static void echo(int argc, char ** argv);
+    static void battery(int argc, char ** argv);
+    static void controller(int argc, char ** argv);
+    static void motor(int argc, char ** argv);
+    static void scan(int argc, char ** argv);
+    static void drive(int argc, char ** argv);
+    static void get(int argc, char ** argv);
+    static void set(int argc, char ** argv);
+    static void save(int argc, char ** argv);
+    static void load(int argc, char ** argv);
+    static void freeze(int argc, char ** argv);
+    static void unfreeze(int argc, char ** argv);
+
+    // Polls the received characters every DEBUGGER_POLL_INTERVAL, handling each complete line
+    static void _task(void * param);
+
+    // Blocks reading the serial input, passing each character received to the debugger task
+    static void _reader(void * param);
+
+  public:
+    // Starts the debugging task
+    static void start();
+
+    // Stops the debugging task
+    static void stop();
+
+    // Returns whether the debugging task is running
+    static bool isRunning();
+
+    // Handles the received characters without blocking, handling each complete line
+    static void poll();
+};
+
+#endif
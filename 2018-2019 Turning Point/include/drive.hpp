@@ -2,88 +2,253 @@
 #define _DRIVE_HPP_
 
 #include "main.h"
+#include "inputcurve.hpp"
+#include "pid.hpp"
+#include <atomic>
 #include <utility>
 #include <vector>
 
 /*
- * Class meant to control robot H-drive
+ * An enumeration specifying the position of a drive motor, deciding which commands it follows
+ * Other motors are on a side but not a corner, and follow the average of their side's front and back commands
+ */
+
+typedef enum motor_role : int {
+  E_MOTOR_FRONT_LEFT,
+  E_MOTOR_BACK_LEFT,
+  E_MOTOR_FRONT_RIGHT,
+  E_MOTOR_BACK_RIGHT,
+  E_MOTOR_OTHER_LEFT,
+  E_MOTOR_OTHER_RIGHT,
+  E_MOTOR_ROLE_COUNT
+} motor_role;
+
+/*
+ * A class meant to hold a group of drive motors contiguously, each tagged with its role
  *
- * The current implementation supports multiple motors for
- * each of the two sides and will respect the given mutex
+ * Commands are given per role, or to every motor, and are issued in a single pass over the group
+ * The group holds a fixed number of motors and never allocates
  *
- * Meant to have its run() method called each pass of the opcontrol while loop
- * approx. every 20 ms
+ * The power, brake mode and encoder units last sent to each motor are remembered, and repeated
+ * writes are skipped, except that every REFRESH_SKIPS consecutive skips the write is sent again
+ * in case the motor was unplugged and reconnected
  */
 
-class DriveControl {
-  friend class DriveFunction;
+class MotorGroup {
+  public:
+    // The most motors a group can hold
+    static const int MAX_MOTORS = 12;
+
+    // Consecutive skipped writes after which a write is sent again
+    static const int REFRESH_SKIPS = 25;
+
   private:
-    // The mutex to take before attempting to move the motors
-    pros::Mutex * lock;
+    // The motors and their roles
+    pros::Motor * motors[MAX_MOTORS];
+    motor_role roles[MAX_MOTORS];
+    int count;
+
+    // The power, brake mode and encoder units last sent to each motor, and how many writes of each have been skipped since
+    int powers[MAX_MOTORS];
+    int powerSkips[MAX_MOTORS];
+    int brakes[MAX_MOTORS];
+    int brakeSkips[MAX_MOTORS];
+    int units[MAX_MOTORS];
+    int unitSkips[MAX_MOTORS];
+
+    // Counts of writes sent and skipped by every group
+    static std::uint32_t sent;
+    static std::uint32_t saved;
+
+    // Returns whether a write changing the cached value to the given value should be sent, updating the cache
+    static bool update(int & cached, int value, int & skips);
+
+    // Forgets what was last sent to the motor at the given index
+    void invalidate(int index);
+
+  public:
+    // Creates an empty Motor Group
+    MotorGroup();
+
+    // Returns whether the role is on the left side of the robot
+    static bool isLeft(motor_role role);
+
+    // Returns the role of the other motors on the same side as the given role
+    static motor_role otherRole(motor_role role);
+
+    // Adds a motor with the given role, returning whether there was room
+    bool add(pros::Motor * motor, motor_role role);
+
+    // Removes all motors from the group
+    void clear();
+
+    // Removes all motors with the given role from the group
+    void clear(motor_role role);
+
+    // Returns the amount of motors in the group
+    int size();
 
-    // Lists of motors for the left sides
-    std::vector<pros::Motor*> otherLeftMotors;
-    std::vector<pros::Motor*> frontLeftMotors;
-    std::vector<pros::Motor*> backLeftMotors;
+    // Returns the amount of motors with the given role
+    int size(motor_role role);
 
-    // Lists of motors for the right sides
-    std::vector<pros::Motor*> otherRightMotors;
-    std::vector<pros::Motor*> frontRightMotors;
-    std::vector<pros::Motor*> backRightMotors;
+    // Returns the motor at the given index, or NULL if there is none
+    pros::Motor * get(int index);
 
-    // Iterates and runs left motors at a given power
-    void runLeftMotors(int power);
+    // Returns the role of the motor at the given index
+    motor_role getRole(int index);
 
-    // Iterates and runs right motors at a given power
-    void runRightMotors(int power);
+    // Runs every motor at the power given for its role, ranging from -127 to 127
+    void move(const int powers[E_MOTOR_ROLE_COUNT]);
 
-    // Iterates and runs the front left motors at a given power
-    void runFrontLeftMotors(int power);
+    // Runs every motor at the same power, ranging from -127 to 127
+    void move(int power);
 
-    // Iterates and runs the back left motors at a given power
-    void runBackLeftMotors(int power);
+    // Moves every motor the amount of degrees given for its role, at the given maximum velocity
+    void moveRelative(const int degrees[E_MOTOR_ROLE_COUNT], int velocity);
 
-    // Iterates and runs the front right motors at a given power
-    void runFrontRightMotors(int power);
+    // Sets the brake mode of every motor to the mode given for its role
+    void setBrake(const pros::motor_brake_mode_e_t modes[E_MOTOR_ROLE_COUNT]);
 
-    // Iterates and runs the back right motors at a given power
-    void runBackRightMotors(int power);
+    // Sets the brake mode of every motor to the same mode
+    void setBrake(pros::motor_brake_mode_e_t mode);
 
-    // Iterates and sets the brake mode of all left motors to a given mode
-    void setLeftBrake(pros::motor_brake_mode_e_t mode);
+    // Zeroes the encoders of every motor in degrees, counting the disconnected motors on each side into the given array, left then right
+    void tare(int disconnected[2]);
 
-    // Iterates and sets the brake mode of all right motors to a given mode
-    void setRightBrake(pros::motor_brake_mode_e_t mode);
+    // Reads the position of every motor into the given array, indexed the same as the group
+    void getPositions(double positions[MAX_MOTORS]);
 
-    // Iterates and sets the brake mode of front left motors to a given mode
-    void setFrontLeftBrake(pros::motor_brake_mode_e_t mode);
+    // Reads the average position of each role's motors into the given array, with 0 for roles without motors
+    void averagePositions(double averages[E_MOTOR_ROLE_COUNT]);
 
-    // Iterates and sets the brake mode of back left motors to a given mode
-    void setBackLeftBrake(pros::motor_brake_mode_e_t mode);
+    // Forgets what was last sent to every motor, so the next write of each kind is sent
+    void invalidate();
 
-    // Iterates and sets the brake mode of front right motors to a given mode
-    void setFrontRightBrake(pros::motor_brake_mode_e_t mode);
+    // Records the position, velocity, current and temperature of every motor to the record log
+    void recordStatus();
 
-    // Iterates and sets the brake mode of back right motors to a given mode
-    void setBackRightBrake(pros::motor_brake_mode_e_t mode);
+    // Returns the amount of motor writes sent by every group
+    static std::uint32_t getWritesSent();
+
+    // Returns the amount of repeated motor writes skipped by every group
+    static std::uint32_t getWritesSaved();
+};
+
+/*
+ * An enumeration specifying how the drive task applies a drive command
+ * Power commands are applied every tick, relative moves are applied once
+ * Tare commands zero the motors once, then are applied every tick as power commands
+ */
+
+typedef enum drive_command_type : int {
+  E_DRIVE_COMMAND_NONE,
+  E_DRIVE_COMMAND_POWER,
+  E_DRIVE_COMMAND_RELATIVE,
+  E_DRIVE_COMMAND_TARE
+} drive_command_type;
+
+/*
+ * A command for the drive motors, with a power or an amount of degrees and a brake mode for each role
+ */
+
+struct DriveCommand {
+  drive_command_type type;
+  int values[E_MOTOR_ROLE_COUNT];
+  pros::motor_brake_mode_e_t brakes[E_MOTOR_ROLE_COUNT];
+  int velocity;
+};
+
+/*
+ * A class meant to pass the latest drive command to the drive task without locking
+ *
+ * Each post replaces the previous command, so only the latest is ever applied
+ * The sequence number is odd while a post is being written. A read overlapping a post fails instead
+ * of waiting, as the drive task may have interrupted the posting task, and is retried next tick
+ * A posting task deleted mid-post, as happens on every mode switch, leaves the sequence odd, so each post
+ * starts from the next even number
+ *
+ * Only one task may post at a time. The competition tasks never run at once, so the running one owns the mailbox
+ */
+
+class DriveMailbox {
+  private:
+    // The latest command and its sequence number
+    DriveCommand command;
+    std::atomic<std::uint32_t> sequence;
+
+  public:
+    // Creates a mailbox holding no command
+    DriveMailbox();
+
+    // Replaces the latest command, returning its sequence number
+    std::uint32_t post(const DriveCommand & command);
+
+    // Copies the latest command, returning whether it was read without overlapping a post
+    bool read(DriveCommand & command, std::uint32_t & sequence);
+};
+
+/*
+ * Class meant to control robot H-drive
+ *
+ * The current implementation supports multiple motors for
+ * each of the two sides
+ *
+ * Meant to have its run() method called each pass of the opcontrol while loop
+ * approx. every 20 ms. The run methods post their outputs to the mailbox, and
+ * the drive task issues the latest one to the motors
+ */
+
+class DriveControl {
+  friend class DriveFunction;
+  public:
+    // The amount of points in the strafe compensation table
+    static const int STRAFE_TABLE_SIZE = 9;
+
+  private:
+    // The latest command posted for the drive task
+    DriveMailbox mailbox;
+
+    // The strafe voltage at each point of the strafe compensation table, and the voltage added to every motor to cancel drift at it
+    static const int strafeVoltages[STRAFE_TABLE_SIZE];
+    double strafeCompensation[STRAFE_TABLE_SIZE];
+
+    // The command being applied by the drive task, and its sequence number
+    DriveCommand command;
+    std::uint32_t applied;
+
+    // The sequence number of the last tare command applied, and the disconnected motors it found on each side
+    std::atomic<std::uint32_t> tared;
+    int disconnected[2];
+
+    // Whether the drive task should forget what it last sent to the motors before its next write
+    std::atomic<bool> invalidateRequested;
+
+    // The drive motors, tagged with their position on the robot
+    MotorGroup motors;
+
+    // The response curves shaping the stick values given to runH()
+    InputCurve moveCurve;
+    InputCurve turnCurve;
+
+    // Posts a power command with the same brake mode for every role
+    void postPowers(const int powers[E_MOTOR_ROLE_COUNT], bool brake);
 
     // The middleman to facilitate choosing between a PID calculation or a simple move_relative() motor command
     // PIDCommand runMotorsRelative(PID * pid, PIDCalc * calc, std::vector<pros::Motor*> motors, int target);
 
   public:
     // Creates the Drive Control object with one left and one right motor, see below
-    explicit DriveControl(pros::Mutex * motorLock, pros::Motor * leftMotor, pros::Motor * rightMotor);
+    explicit DriveControl(pros::Motor * leftMotor, pros::Motor * rightMotor);
 
     /*
      * Creates the Drive Control object
      *
-     * motorLock: the mutex it will attempt to take when accessing the motors
      * frontLeftMotor: a motor on the left side of the robot
      * rearLeftMotor: a motor on the left side of the robot
      * frontRightMotor: a motor on the right side of the robot
      * rearRightMotor: a motor on the right side of the robot
      */
-    explicit DriveControl(pros::Mutex * motorLock, pros::Motor * frontLeftMotor, pros::Motor * rearLeftMotor, pros::Motor * frontRightMotor, pros::Motor * rearRightMotor);
+    explicit DriveControl(pros::Motor * frontLeftMotor, pros::Motor * rearLeftMotor, pros::Motor * frontRightMotor, pros::Motor * rearRightMotor);
 
     // Reinitializes the motors of the Drive Control object with 2 motors
     void reinitialize(pros::Motor * leftMotor, pros::Motor * rightMotor);
@@ -130,6 +295,15 @@ class DriveControl {
     // Clears all motors from the back right motors list
     void clearBackRightMotors();
 
+    // Returns the drive motors
+    MotorGroup * getMotors();
+
+    // Returns the response curve shaping the movement stick value given to runH()
+    InputCurve * getMoveCurve();
+
+    // Returns the response curve shaping the turning stick value given to runH()
+    InputCurve * getTurnCurve();
+
     // Sets left and right PID constants to the same values, see PID documentation
     // void setPID(int dt, double kp, double ki, double kd, bool brake, int tLimit, double aLimit, int iLimit, int iZone, int dThreshold, int tThreshold, int de0);
 
@@ -177,6 +351,7 @@ class DriveControl {
 
     /*
      * Runs the Robot H-Drive Control by calculating the values for the left and right motors
+     * The voltages are shaped by the move and turn response curves before the sensitivity is applied
      *
      * moveVoltage: the movement voltage, forward or backward, ranging from -127 to 127
      * turnVoltage: the turning voltage ranging from -127 to 127
@@ -216,6 +391,43 @@ class DriveControl {
 
     // Stops all drive motors, braking if requested
     void stop(bool brake);
+
+    // Returns the strafe voltage of the given point in the strafe compensation table
+    static int getStrafeTableVoltage(int index);
+
+    // Sets the voltage added to every motor to cancel drift at each point in the strafe compensation table
+    void setStrafeCompensation(const double compensation[STRAFE_TABLE_SIZE]);
+
+    // Returns the voltage added to every motor to cancel drift at the given point in the strafe compensation table
+    double getStrafeTableCompensation(int index);
+
+    // Returns the voltage to add to every motor to cancel drift while strafing at the given voltage, interpolated from the table
+    double getStrafeCompensation(double strafeVoltage);
+
+    // Reads the strafe compensation table from the given file, returning whether it was successful
+    bool loadStrafeCompensation(std::string path);
+
+    // Writes the strafe compensation table to the given file, returning whether it was successful
+    bool saveStrafeCompensation(std::string path);
+
+    // Posts a command for the drive task to apply, returning its sequence number
+    std::uint32_t post(const DriveCommand & command);
+
+    /*
+     * Stops the motors and zeroes them through the drive task, waiting up to DRIVE_TARE_TIMEOUT for it
+     * Returns whether the drive task zeroed them, with the amount of disconnected motors on the left and right sides
+     */
+    bool tare(int disconnected[2]);
+
+    // Has the drive task forget what it last sent to the motors before its next write, so every write is sent
+    // Called on each mode change, as the motors may have been changed outside the drive task while disabled
+    void invalidate();
+
+    // Issues the latest posted command to the motors. Called by the drive task every tick
+    void update();
+
+    // The drive task, updating the Drive Control object given as its parameter every DRIVE_TASK_INTERVAL
+    static void task(void * driveControl);
 };
 
 /*
@@ -231,6 +443,9 @@ class DriveFunction {
     // The DriveControl object to wrap and/or call
     DriveControl * driveControl;
 
+    // The PID controllers of each motor role, reused by every motion
+    PIDGroup pidGroup;
+
     // Values influencing gear ratio
     double in;
     double out;
@@ -270,17 +485,24 @@ class DriveFunction {
     int pt;
     int kt;
 
+    // The gyro and heading PID values to pivot with, if a gyro is mounted
+    pros::ADIGyro * gyro;
+    PID * gyroPID;
+
     // The amount to move the motors to strafe one inch
     int ks;
 
     // Resets motor encoders in preparation for a movement, returning whether it was successful
     bool movementReset();
 
-    // Returns the average poasitions of motors
-    double averagePosition(std::vector<pros::Motor *> motors);
+    // Pivots the robot the given degrees using the gyro's heading as feedback
+    void pivotGyro(int degrees);
+
+    // Drives with the given voltages for STRAFE_CALIBRATION_TIME, returning how far the robot moved forward in degrees
+    double measureForward(int moveVoltage, int strafeVoltage);
 
-    // Issues movement commands to drive motors
-    void moveRelative(bool usePID, PID * frontLeftPID, PID * backLeftPID, PID * frontRightPID, PID * backRightPID, int frontLeftDegrees, int backLeftDegrees, int frontRightDegrees, int backRightDegrees);
+    // Issues movement commands to drive motors, cancelling strafe drift with the compensation table if strafing
+    void moveRelative(bool usePID, PID * frontLeftPID, PID * backLeftPID, PID * frontRightPID, PID * backRightPID, int frontLeftDegrees, int backLeftDegrees, int frontRightDegrees, int backRightDegrees, bool strafe);
 
   public:
     // Creates a Drive Function object, wrapping the given Drive Control
@@ -340,12 +562,30 @@ class DriveFunction {
     // Clears the strafe PID
     void clearStrafePID();
 
+    /*
+     * Sets the gyro to pivot with, turning until its heading reaches the target instead of using the turn values
+     *
+     * gyro: the gyro, reading positive in the direction a positive pivot turns. Use a negative multiplier if it is mounted upside down
+     * pid: the PID values to turn with, in tenths of a degree. The acceleration limit ramps the turn up
+     */
+    void setGyro(pros::ADIGyro * gyro, PID * pid);
+
+    // Clears the gyro, pivoting with the turn values
+    void clearGyro();
+
     // Pivots the robot, specifying how for to turn
     void pivot(int degrees);
 
     // Stafes the robot, given the amount of inches
     void strafe(double inches);
 
+    /*
+     * Learns the strafe compensation table by strafing at each of its voltages and measuring the forward drift
+     * Each point is corrected by the voltage that would cancel the drift measured with its current compensation,
+     * so running it again refines the table. Needs room to strafe in both directions. Saves to STRAFE_TABLE_PATH
+     */
+    void calibrateStrafe();
+
     // Moves the robot forward the given amount of inches, calculated using the given gear ratio
     void move(double inches);
 
@@ -7,12 +7,18 @@
 class ControllerBattery;
 class DriveControl;
 class DriveFunction;
+class DriveMailbox;
 class Debugger;
+class InputCurve;
 class LCD;
 class Logger;
+class MotorGroup;
 class PID;
 class PIDCalc;
 class PIDCommand;
+class PIDGroup;
+class RecordLog;
+class Tunables;
 
 enum pid_command : int;
 
@@ -60,8 +60,6 @@ namespace ports {
   // Vision
   extern pros::Vision * flagVision;
 
-  // Mutexes
-  extern pros::Mutex * driveLock;
   // Driving
   extern DriveControl * driveControl;
   extern DriveFunction * drive;
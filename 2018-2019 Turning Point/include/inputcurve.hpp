@@ -0,0 +1,41 @@
+#ifndef _INPUTCURVE_HPP_
+#define _INPUTCURVE_HPP_
+
+#include "main.h"
+
+/*
+ * A class to shape an analog stick value into a drive output through a precomputed response curve
+ *
+ * The deadband and expo of the curve are computed into a table of every stick value when configured, so
+ * shaping a stick value each pass of the opcontrol loop is one lookup plus an optional slew limit
+ */
+
+class InputCurve {
+  private:
+    // The shaped output for every stick value, indexed by the stick value plus 128
+    std::int8_t table[256];
+
+    // The maximum increase in output magnitude each call, 0 to disable
+    int slew;
+
+    // The last shaped output, used for the slew limit
+    int last;
+
+  public:
+    // Creates the Input Curve object with a linear response
+    InputCurve();
+
+    /*
+     * Precomputes the response table
+     *
+     * deadband: stick values with a magnitude at or below this give no output
+     * expo: the blend between a linear (0) and cubic (1) response past the deadband
+     * slew: the maximum increase in output magnitude each call, 0 to disable
+     */
+    void configure(int deadband, double expo, int slew);
+
+    // Returns the shaped output, ranging from -127 to 127, for the given stick value
+    int shape(int value);
+};
+
+#endif
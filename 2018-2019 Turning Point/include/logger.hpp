@@ -29,6 +29,14 @@ typedef enum logging_levels_e {
  *
  * Log to PROS terminal by using the path "/ser/sout"
  * Log to a micro SD card by placing a "/usd/" prefix to your file name
+ *
+ * The numbered logs in LOGS_PATH are listed in an index holding the next log number and the size of each log,
+ * so starting up does not search the SD card. The index is written to two files in turn, each with a sequence
+ * number and checksum, so a write cut short by a power loss leaves the other intact. The numbered log is rotated
+ * once it reaches LOGS_ROTATE_SIZE, and the oldest logs are removed to stay within LOGS_MAX_COUNT and LOGS_MAX_SIZE
+ *
+ * Each numbered log has a binary record log of the same number, see RecordLog, which is rotated and removed with it.
+ * The size of a numbered log in the index includes its record log
  */
 
 class Logger {
@@ -42,6 +50,19 @@ class Logger {
     std::string fileName;
     FILE * logfile;
 
+    // Whether this logger writes the numbered logs, and how many bytes it has written to the current one
+    bool numbered;
+    long size;
+
+    // The numbered logs, oldest first, with their sizes and the number of the next log, as recorded in the index
+    static int logNumbers[LOGS_MAX_COUNT + 1];
+    static long logSizes[LOGS_MAX_COUNT + 1];
+    static int logCount;
+    static int nextLog;
+
+    // The sequence number of the last index written
+    static std::uint32_t indexSequence;
+
     // Creates the Logger object, given a minimum logging level, filename, and file pointer
     explicit Logger(logging_levels mLevel, std::string filename, FILE * file);
 
@@ -54,11 +75,38 @@ class Logger {
     // Checks whether a file exists
     static bool fileExists(std::string name);
 
+    // Returns the size of the file, or 0 if it does not exist
+    static long getFileSize(std::string name);
+
+    // Returns the path of the numbered log
+    static std::string getLogPath(int number);
+
+    // Returns the path of the binary record log started with the numbered log
+    static std::string getRecordPath(int number);
+
+    // Reads one copy of the index, using it if it is complete, its checksum matches and it is newer than the given sequence number, which is updated
+    static bool readIndex(std::string path, std::uint32_t & sequence);
+
+    // Loads the newest complete copy of the index, or builds one by searching for existing logs
+    static void loadIndex();
+
+    // Writes the index over its older copy
+    static void writeIndex();
+
+    // Removes the oldest logs until the limits are met, keeping the newest
+    static void pruneLogs();
+
+    // Starts the next numbered log, returning its path
+    static std::string startNumberedLog();
+
+    // Moves this logger and the record log on to the next numbered log
+    void rotate();
+
   public:
     // Returns the file the logger is associated to
     FILE * getFile();
 
-    // Intializes the default loggers, include serial output and logging files on the microSD card
+    // Intializes the default loggers, include serial output and logging files on the microSD card, and starts the record log
     static void initializeDefaultLoggers();
 
     // Initalize a log output stream to a file with the given name using the default minimum log level. See below
@@ -78,12 +78,16 @@ void opcontrol(void);
 //#include <iostream>
 #include "forward.hpp"
 #include "constants.hpp"
+#include "debugger.hpp"
 #include "definitions.hpp"
 #include "drive.hpp"
 #include "global.hpp"
+#include "inputcurve.hpp"
 #include "lcd.hpp"
 #include "logger.hpp"
 #include "pid.hpp"
+#include "recordlog.hpp"
+#include "tunables.hpp"
 #include "util.hpp"
 #endif
 
@@ -53,6 +53,9 @@ class PID {
      */
     PIDCommand calculate(PIDCalc * calc, int position, int target);
 
+    // Limits how much faster the power is than the last power in the calculation values by aLimit, returning the limited power
+    double limitAcceleration(PIDCalc * calc, double power);
+
 };
 
 /*
@@ -112,4 +115,79 @@ class PIDCommand {
 
 };
 
+/*
+ * A class meant to run several PID controllers towards their own targets together
+ *
+ * Each channel has its own PID constants and is calculated at its own dt, with its calculation values held
+ * in a fixed array so nothing is allocated per motion. The channels still moving are kept in step by cross-coupling:
+ * each channel's power is reduced by kSync for every degree it is ahead of the average progress of the group, and
+ * increased for every degree it is behind. Each channel's acceleration limit applies to its power after coupling
+ */
+
+class PIDGroup {
+  public:
+    // The most channels a group can run
+    static const int MAX_CHANNELS = 8;
+
+  private:
+    // The PID constants, calculation values and target of each channel
+    PID * pids[MAX_CHANNELS];
+    PIDCalc calcs[MAX_CHANNELS];
+    int targets[MAX_CHANNELS];
+    int count;
+
+    // The last power of each channel, after cross-coupling and the acceleration limit, and the time it was calculated
+    int powers[MAX_CHANNELS];
+    std::uint32_t times[MAX_CHANNELS];
+
+    // The exit status of each channel, or E_COMMAND_CONTINUE if it has not completed
+    pid_command_type statuses[MAX_CHANNELS];
+
+    // The cross-coupling gain, in power per degree of difference in progress
+    double kSync;
+
+  public:
+    // Creates an empty PID group using PID_SYNC_KP for cross-coupling
+    PIDGroup();
+
+    // Removes all channels, ready for the next motion
+    void clear();
+
+    // Adds a channel moving to the given target, returning its index or -1 if there was no room. Channels with a target of 0 start complete
+    int add(PID * pid, int target);
+
+    // Returns the amount of channels
+    int size();
+
+    // Sets the cross-coupling gain, use 0 to run the channels independently
+    void setSync(double kSync);
+
+    /*
+     * Calculates the power of each channel whose dt has passed, keeping the last power of the others
+     *
+     * positions: the current position of each channel
+     * powers: the array to fill with the power of each channel
+     * time: the current time in ms
+     */
+    void calculate(const double positions[], int powers[], std::uint32_t time);
+
+    // Returns whether every channel has completed
+    bool isComplete();
+
+    // Returns whether the channel has completed
+    bool isComplete(int channel);
+
+    // Returns the exit status of the channel, E_COMMAND_EXIT_SUCCESS or E_COMMAND_EXIT_FAILURE, or E_COMMAND_CONTINUE if it has not completed
+    pid_command_type getStatus(int channel);
+
+    // Returns the error of the channel in its last calculation
+    int getError(int channel);
+
+    // Returns the PID constants of the channel
+    PID * getPID(int channel);
+
+    // Returns the time until a channel is next due to be calculated, the smallest dt of the channels
+    int getInterval();
+};
+
 #endif
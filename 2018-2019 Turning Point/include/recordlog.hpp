@@ -0,0 +1,77 @@
+#ifndef _RECORDLOG_HPP_
+#define _RECORDLOG_HPP_
+
+#include "main.h"
+#include <cstdio>
+
+/*
+ * An enumeration specifying the types of record in the binary log
+ *
+ * The meaning of each record's port and fields is given by its type's schema, see recordlog.cpp
+ */
+
+typedef enum record_type : int {
+  E_RECORD_MOVEMENT,
+  E_RECORD_PID_COMPLETE,
+  E_RECORD_MOTOR_STATUS,
+  E_RECORD_CONTROLLER,
+  E_RECORD_TYPE_COUNT
+} record_type;
+
+/*
+ * A class to log typed records to a binary file, queried on a computer with tools/logquery.cpp
+ *
+ * Every record has a time, a type, a port and RECORD_FIELDS integer fields. The file starts with the schema of
+ * each type, naming its port and fields. Records are buffered and written in blocks of columns: the times of
+ * the block's records, then their types, then their ports, then each field in turn, so a reader can skip a
+ * block from its times alone. Recording neither allocates nor formats text
+ *
+ * Like Logger, only one task should record at a time
+ */
+
+class RecordLog {
+  public:
+    // The amount of fields in every record
+    static const int RECORD_FIELDS = 4;
+
+    // The most records buffered before a block is written
+    static const int BLOCK_RECORDS = 128;
+
+  private:
+    // The file the records are written to, empty if not recording
+    static std::string path;
+
+    // The columns of the buffered records
+    static std::uint32_t times[BLOCK_RECORDS];
+    static std::uint8_t types[BLOCK_RECORDS];
+    static std::uint8_t ports[BLOCK_RECORDS];
+    static std::int32_t fields[RECORD_FIELDS][BLOCK_RECORDS];
+    static int count;
+
+    // The bytes written to the file
+    static long size;
+
+  public:
+    // Starts recording to the file with the given name, writing the schema of each record type
+    static void init(std::string path);
+
+    /*
+     * Records an event
+     *
+     * type: the type of record
+     * port: the port or other source of the record, as named by its schema
+     * a, b, c, d: the fields of the record, as named by its schema
+     */
+    static void record(record_type type, int port, int a, int b, int c, int d);
+
+    // Writes the buffered records as a block
+    static void flush();
+
+    // Returns the bytes written to the file, not counting the buffered records
+    static long getSize();
+
+    // Returns the name of the record type
+    static std::string getTypeName(record_type type);
+};
+
+#endif
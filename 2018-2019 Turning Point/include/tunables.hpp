@@ -0,0 +1,96 @@
+#ifndef _TUNABLES_HPP_
+#define _TUNABLES_HPP_
+
+#include "main.h"
+#include <atomic>
+
+/*
+ * A class holding a registry of named values which can be tuned over the USB debugger while the robot runs
+ *
+ * Each tunable points to the value it tunes, such as a PID constant, which is only changed by apply(). New
+ * values are staged into a second copy of every tunable, guarded by a sequence number which is odd while a
+ * change is being staged. apply() copies the staged values over the live values only when no change is in
+ * progress, and never waits for one, so calling it between PID calculations means a calculation never sees
+ * half of a change. Only the tunables set since the last apply are written, so a value the program changes
+ * itself is kept until it is tuned again. Tunables may be saved to and loaded from a file as lines of names and
+ * values
+ *
+ * Only one task should stage changes. Tunables should be added and removed by the task calling apply(), and a
+ * tunable must be removed before the value it points to is freed
+ */
+
+class Tunables {
+  public:
+    // The most tunables the registry can hold
+    static const int MAX_TUNABLES = 160;
+
+    // The longest name of a tunable, including the terminator
+    static const int NAME_LENGTH = 32;
+
+  private:
+    // The name of each tunable, and the live value it points to, either a decimal or an integer
+    static char names[MAX_TUNABLES][NAME_LENGTH];
+    static double * doubles[MAX_TUNABLES];
+    static int * ints[MAX_TUNABLES];
+    static int count;
+
+    // The staged value of each tunable, and the sequence number of the change which last set it
+    static double staged[MAX_TUNABLES];
+    static std::uint32_t changed[MAX_TUNABLES];
+
+    // The sequence number of the staged values, odd while a change is being staged, and the last applied
+    static std::atomic<std::uint32_t> sequence;
+    static std::atomic<std::uint32_t> applied;
+
+    // Adds a tunable with the given name pointing to either value, returning whether there was room
+    static bool add(const char * name, double * doubleValue, int * intValue);
+
+  public:
+    // Adds a tunable with the given name, returning whether there was room
+    static bool add(const char * name, double * value);
+    static bool add(const char * name, int * value);
+
+    // Adds the gains, limits and thresholds of the PID as tunables named with the prefix
+    static void addPID(const char * prefix, PID * pid);
+
+    // Removes each tunable pointing to the value, leaving an empty slot for the next tunable added
+    static void remove(void * value);
+
+    // Removes the tunables added by addPID()
+    static void removePID(PID * pid);
+
+    // Returns the amount of slots in the registry, including the empty slots of removed tunables
+    static int size();
+
+    // Returns the index of the tunable with the given name, or -1 if there is none
+    static int find(const char * name);
+
+    // Returns the name of the tunable at the given index, empty if it was removed
+    static const char * getName(int index);
+
+    // Returns the staged value of the tunable at the given index, which is the live value once applied
+    static double get(int index);
+
+    // Returns whether staged changes are waiting to be applied
+    static bool isPending();
+
+    /*
+     * Stages changes to the tunables, applied together by the next apply()
+     *
+     * Call begin(), set() each value, then end()
+     */
+    static void begin();
+    static void set(int index, double value);
+    static void end();
+
+    // Copies the staged values over the live values if they have changed, returning whether they were applied
+    static bool apply();
+
+    // Writes the staged values to the file, returning whether it was successful
+    static bool save(std::string path);
+
+    // Stages the values in the file, logging each which differs, returning whether it was read. Names not in the registry are ignored
+    static bool load(std::string path);
+};
+
+#endif
@@ -16,6 +16,9 @@ void ports::init() {
   // Driving sensitivity
   ::sensitivity = 1.0;
   ::adjustingSensitivity = 0.45;
+  // Driving response curves, ignoring stick drift and softening small turns
+  driveControl->getMoveCurve()->configure(5, 0, 0);
+  driveControl->getTurnCurve()->configure(5, 0.3, 0);
 
   // Forward PID values
   PID * forwardFrontLeftPID = new PID(20, 0.44000, 0.00000, -0.25000, true, 110, 11, 10000, 200, true, MOTOR_MOVE_RELATIVE_THRESHOLD, 7, 7);
@@ -49,10 +52,18 @@ void ports::init() {
   // Set the PID values
   drive->setStrafePID(strafeFrontLeftPID, strafeBackLeftPID, strafeFrontRightPID, strafeBackRightPID);
 
+  // Make the driving sensitivity tunable over the USB debugger, the PID constants are made tunable as they are set
+  Tunables::add("sensitivity", &::sensitivity);
+
   // Sets the gear ratio of drive
   drive->setGearRatio(1, 1, 4);
   // Sets the turn values of drive
   drive->setTurnValues(852, 54);
+  // Load the calibrated strafe compensation, if there is one
+  if (SD_INSERTED)
+    driveControl->loadStrafeCompensation(STRAFE_TABLE_PATH);
+  // No gyro is mounted, so pivots use the turn values. Once one is, set it to pivot using its heading instead
+  // drive->setGyro(new pros::ADIGyro('A'), new PID(20, 0.60000, 0.00000, 2.00000, true, 110, 8, 10000, 100, true, 10, 5, 10));
 }
 
 // This file uses many of the fields in the ports namespace. Dump it into the global namespace for ease of programming
@@ -67,12 +78,18 @@ using namespace ports;
 void initialize() {
   // Initialize the ports
   ports::init();
+  // Start the drive task, issuing the latest drive command to the motors
+  pros::Task driveTask(DriveControl::task, driveControl, TASK_PRIORITY_DEFAULT + 1, TASK_STACK_DEPTH_DEFAULT, "Drive");
   // Initialize the LCD of the brain and the controllers
   LCD::initialize(controllerMain, controllerPartner);
   // Initialize all the loggers that log to the microSD card
   Logger::initializeDefaultLoggers();
-  // Initialize the USB debugger
-  // Debugger::start(driveControl, drive);
+  // Apply the tunables saved over the USB debugger, if there are any, once they can be logged
+  if (SD_INSERTED && TUNABLES_LOAD_SAVED && Tunables::load(TUNABLES_PATH))
+    Tunables::apply();
+  // Start the USB debugger
+  if (DEBUGGER_ENABLED)
+    Debugger::start();
 
   // Simple header to signal the start of a new program in a log file
   Logger::log(LOG_INFO, "#####################################");
@@ -107,6 +124,8 @@ void competition_initialize() {}
  */
 void autonomous() {
   autonomousComplete = false;
+  // Send every drive motor write again, as the motors may have changed while disabled
+  driveControl->invalidate();
   /*
   if (selectedAutonomous == 1) { // Red flags
   } else if (selectedAutonomous == 2) { // Red far
@@ -121,6 +140,8 @@ void autonomous() {
 
   end:
   autonomousComplete = true;
+  // Write the records of the autonomous
+  RecordLog::flush();
 }
 
 
@@ -142,6 +163,8 @@ void opcontrol() {
   // Log the start of operator control to signify in a log file the location of the log
   Logger::log(LOG_INFO, "---===( Operator Control )===---");
   LCD::setStatus("Operator Control");
+  // Send every drive motor write again, as the motors may have changed since the last mode
+  driveControl->invalidate();
 
   if (!autonomousComplete) {
     Logger::log(LOG_WARNING, "Autonomous was not completed successfully!");
@@ -150,55 +173,68 @@ void opcontrol() {
 
   // Flag to set when the main controller has disconnected
   bool controllerDC = false;
+  // The amount of cycles run, used to record the drive motors every second
+  int cycles = 0;
 
   start:
 
   // The operator control loop, code here is executed every 20ms when runOperatorControlLoop is set
   while (runOperatorControlLoop) {
 
-    // Runs the debugger and executes any required methods
-    // Debugger::run();
+    // Applies any changes to the tunables between drive commands
+    Tunables::apply();
     // Updates the LCD on every cycle
     LCD::updateScreen();
 
     // Run driving code, this function handles all of the math to do with it. Should never be changed. For motor changes, go to ports::init()
-    drive->runH(controllerMain->get_analog(STICK_LEFT_Y), controllerMain->get_analog(STICK_LEFT_X), true, true, 1.0, 1.0);
+    drive->runH(controllerMain->get_analog(STICK_LEFT_Y), controllerMain->get_analog(STICK_LEFT_X), true, true, ::sensitivity, ::sensitivity);
 
     // Runs simple checks on whether the main controller is disconnected, utilizing controllerDC
     if (!controllerMain->is_connected() && !controllerDC) {
       LCD::setStatus("Operator Controller Disconnected");
       Logger::log(LOG_ERROR, "Operator Controller has been disconnected!");
+      RecordLog::record(E_RECORD_CONTROLLER, 0, false, 0, 0, 0);
       controllerDC = true;
     } else if (controllerMain->is_connected() && controllerDC) {
       LCD::setStatus("Operator Controller Reconnected");
       Logger::log(LOG_INFO, "Operator Controller has been reconnected!");
+      RecordLog::record(E_RECORD_CONTROLLER, 0, true, 0, 0, 0);
       controllerDC = false;
     }
 
+    // Record the drive motors every 50 cycles
+    if (++cycles % 50 == 0)
+      driveControl->getMotors()->recordStatus();
+
     // Maps the left and right buttons on the controller to the left and right buttons on the Brain LCD
     if (controllerMain->get_digital_new_press(BUTTON_LEFT)) LCD::onLeftButton();
     if (controllerMain->get_digital_new_press(BUTTON_RIGHT)) LCD::onRightButton();
     // Calls autonomous
     if (controllerMain->get_digital_new_press(BUTTON_UP)) autonomous();
+    // Calibrates the strafe compensation, which drives the robot by itself, so never while connected to a field
+    if (controllerMain->get_digital_new_press(BUTTON_DOWN) && !pros::competition::is_connected()) drive->calibrateStrafe();
 
     // Run every 20ms
     pros::delay(20);
   }
 
+  // Stop the drive so it does not keep the last command while paused
+  driveControl->stop(true);
+
   // Code loop when the operator control loop is paused. Runs
   while (!runOperatorControlLoop) {
 
-    // Runs the debugger and executes any required methods
-    // Debugger::run();
     // Updates the LCD on every cycle
     LCD::updateScreen();
 
     // Runs simple checks on whether the main controller is disconnected, utilizing controllerDC
     if (!controllerMain->is_connected() && !controllerDC) {
       Logger::log(LOG_ERROR, "Operator Controller has been disconnected!");
+      RecordLog::record(E_RECORD_CONTROLLER, 0, false, 0, 0, 0);
       controllerDC = true;
     } else if (controllerMain->is_connected() && controllerDC) {
       Logger::log(LOG_INFO, "Operator Controller has been reconnected!");
+      RecordLog::record(E_RECORD_CONTROLLER, 0, true, 0, 0, 0);
       controllerDC = false;
     }
 
@@ -227,6 +263,13 @@ void disabled() {
     Logger::log(LOG_WARNING, "Autonomous was not completed successfully!");
     autonomousComplete = true;
   }
+  // Send every drive motor write again, then stop the drive, so the drive task does not resume the last command when the robot is enabled
+  driveControl->invalidate();
+  driveControl->stop(true);
+  // Write the records of the last mode
+  RecordLog::flush();
+  // Log how many drive motor writes have been skipped as repeats
+  Logger::log(LOG_INFO, "Drive motor writes: " + std::to_string(MotorGroup::getWritesSent()) + " sent, " + std::to_string(MotorGroup::getWritesSaved()) + " saved");
   while (true) {
     // Maps the left and right buttons on the controller to the left and right buttons on the Brain LCD
     if (controllerMain->get_digital_new_press(BUTTON_LEFT)) LCD::onLeftButton();
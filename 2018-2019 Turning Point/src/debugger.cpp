@@ -0,0 +1,286 @@
+#include "main.h"
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// The static initializations of private Debugger fields. See the header file for documentation
+pros::Task * Debugger::task = NULL;
+pros::Task * Debugger::reader = NULL;
+pros::c::queue_t Debugger::input = NULL;
+char Debugger::line[LINE_LENGTH];
+int Debugger::length = 0;
+bool Debugger::overflow = false;
+char Debugger::response[RESPONSE_LENGTH];
+
+// The command table, searched in order
+const Debugger::Command Debugger::commands[] = {
+  {"help", "help: lists the commands", Debugger::help},
+  {"echo", "echo <text>: repeats the text", Debugger::echo},
+  {"battery", "battery: shows the brain battery", Debugger::battery},
+  {"controller", "controller: shows the controllers", Debugger::controller},
+  {"motor", "motor <port>: shows the motor on the port", Debugger::motor},
+  {"scan", "scan: lists the ports with motors", Debugger::scan},
+  {"drive", "drive: shows the drive motors and the motor writes saved", Debugger::drive},
+  {"get", "get [prefix]: shows the tunables starting with the prefix", Debugger::get},
+  {"set", "set <tunable> <value>: changes the tunable between calculations", Debugger::set},
+  {"save", "save: writes the tunables to the microSD card", Debugger::save},
+  {"load", "load: reads the tunables from the microSD card", Debugger::load},
+  {"freeze", "freeze: pauses the operator control loop and stops the drive, autonomous keeps running", Debugger::freeze},
+  {"unfreeze", "unfreeze: resumes the operator control loop", Debugger::unfreeze}
+};
+const int Debugger::COMMAND_COUNT = sizeof(Debugger::commands) / sizeof(Debugger::commands[0]);
+
+void Debugger::start() {
+  // If the debugger is stopped, start the debugger
+  if (Debugger::task == NULL) {
+    if (Debugger::input == NULL)
+      Debugger::input = pros::c::queue_create(INPUT_LENGTH, sizeof(char));
+    Debugger::length = 0;
+    Debugger::overflow = false;
+    Debugger::task = new pros::Task(Debugger::_task, NULL, DEBUGGER_TASK_PRIORITY, TASK_STACK_DEPTH_DEFAULT, "Debugger");
+    Debugger::reader = new pros::Task(Debugger::_reader, NULL, DEBUGGER_TASK_PRIORITY, TASK_STACK_DEPTH_DEFAULT, "Debugger Reader");
+  }
+}
+
+void Debugger::stop() {
+  // If the debugger is not stopped, erase the debugger and reader tasks from memory as well as from the PROS RTOS API
+  if (Debugger::task != NULL) {
+    Debugger::reader->remove();
+    delete Debugger::reader;
+    Debugger::reader = NULL;
+    Debugger::task->remove();
+    delete Debugger::task;
+    Debugger::task = NULL;
+  }
+}
+
+bool Debugger::isRunning() {
+  // Returns whether the debugger task exists
+  return Debugger::task != NULL;
+}
+
+void Debugger::_task(void *) {
+  std::uint32_t wake = pros::millis();
+  while (true) {
+    Debugger::poll();
+    pros::Task::delay_until(&wake, DEBUGGER_POLL_INTERVAL);
+  }
+}
+
+void Debugger::_reader(void *) {
+  while (true) {
+    // Block until a character arrives, as PROS 3.1.6 cannot report what is waiting, dropping it if the queue is full
+    int c = getchar();
+    if (c == EOF) {
+      pros::delay(DEBUGGER_POLL_INTERVAL);
+      continue;
+    }
+    char received = c;
+    pros::c::queue_append(Debugger::input, &received, 0);
+  }
+}
+
+void Debugger::poll() {
+  // Take only the characters already received, so polling never blocks
+  char c;
+  while (pros::c::queue_recv(Debugger::input, &c, 0)) {
+    if (c == '\n' || c == '\r') {
+      // Handle the line, unless it was too long to hold
+      if (Debugger::overflow)
+        Debugger::respond("Command too long, the limit is %d characters", LINE_LENGTH - 1);
+      else if (Debugger::length > 0) {
+        Debugger::line[Debugger::length] = '\0';
+        Debugger::execute(Debugger::line);
+      }
+      Debugger::length = 0;
+      Debugger::overflow = false;
+    } else if (c == '\b' || c == 0x7f) { // Backspace was pressed
+      if (Debugger::length > 0)
+        Debugger::length--;
+    } else if (c >= ' ' && c <= '~') {
+      // Keep the character if there is room for it and the terminator
+      if (Debugger::length < LINE_LENGTH - 1)
+        Debugger::line[Debugger::length++] = c;
+      else
+        Debugger::overflow = true;
+    }
+  }
+}
+
+void Debugger::execute(char * line) {
+  // Split the line in place into arguments separated by spaces
+  char * argv[MAX_ARGUMENTS];
+  int argc = 0;
+  char * save;
+  for (char * token = strtok_r(line, " ", &save); token != NULL && argc < MAX_ARGUMENTS; token = strtok_r(NULL, " ", &save))
+    argv[argc++] = token;
+  if (argc == 0)
+    return;
+
+  // Run the handler of the command with the same name
+  for (int i = 0; i < Debugger::COMMAND_COUNT; i++)
+    if (strcmp(argv[0], Debugger::commands[i].name) == 0) {
+      Debugger::commands[i].handler(argc, argv);
+      return;
+    }
+  Debugger::respond("Unknown command: %s, type help for a list of commands", argv[0]);
+}
+
+void Debugger::respond(const char * format, ...) {
+  // Format into the response buffer, truncating if it is too long, and write it as a line
+  va_list args;
+  va_start(args, format);
+  vsnprintf(Debugger::response, RESPONSE_LENGTH, format, args);
+  va_end(args);
+  fputs(Debugger::response, stdout);
+  fputc('\n', stdout);
+  fflush(stdout);
+}
+
+int Debugger::parsePort(const char * argument) {
+  // Ports range from 1 to 21
+  char * end;
+  long port = argument == NULL ? 0 : strtol(argument, &end, 10);
+  if (argument == NULL || *end != '\0' || port < 1 || port > 21) {
+    Debugger::respond("Expected a port from 1 to 21");
+    return 0;
+  }
+  return port;
+}
+
+void Debugger::help(int, char **) {
+  // Lists the usage of each command
+  for (int i = 0; i < Debugger::COMMAND_COUNT; i++)
+    Debugger::respond("%s", Debugger::commands[i].usage);
+}
+
+void Debugger::echo(int argc, char ** argv) {
+  // Repeats the arguments, which were split on spaces
+  Debugger::respond("%s %s %s", argc > 1 ? argv[1] : "", argc > 2 ? argv[2] : "", argc > 3 ? argv[3] : "");
+}
+
+void Debugger::battery(int, char **) {
+  // Shows the state of the brain battery
+  Debugger::respond("Battery: %.0f%%, %.2f V, %.2f A, %.0f C", pros::battery::get_capacity(), pros::battery::get_voltage() / 1000.0, pros::battery::get_current() / 1000.0, pros::battery::get_temperature());
+}
+
+void Debugger::controller(int, char **) {
+  // Shows whether each controller is connected and its battery
+  pros::Controller * controllers[2] = {ports::controllerMain, ports::controllerPartner};
+  const char * names[2] = {"Main", "Partner"};
+  for (int i = 0; i < 2; i++)
+    if (controllers[i]->is_connected())
+      Debugger::respond("%s controller: connected, battery %ld%%", names[i], (long) controllers[i]->get_battery_capacity());
+    else
+      Debugger::respond("%s controller: disconnected", names[i]);
+}
+
+void Debugger::motor(int argc, char ** argv) {
+  int port = Debugger::parsePort(argc > 1 ? argv[1] : NULL);
+  if (port == 0)
+    return;
+
+  // A motor that is not plugged in reports an error for its temperature
+  double temperature = pros::c::motor_get_temperature(port);
+  if (temperature == PROS_ERR_F) {
+    Debugger::respond("Port %d: no motor", port);
+    return;
+  }
+  Debugger::respond("Port %d: position %.1f, target %.1f, velocity %.1f, voltage %ld mV, current %ld mA, %.0f C, faults 0x%lx", port, pros::c::motor_get_position(port), pros::c::motor_get_target_position(port), pros::c::motor_get_actual_velocity(port), (long) pros::c::motor_get_voltage(port), (long) pros::c::motor_get_current_draw(port), temperature, (unsigned long) pros::c::motor_get_faults(port));
+}
+
+void Debugger::scan(int, char **) {
+  // Lists every port reporting a motor temperature
+  int found = 0;
+  for (int port = 1; port <= 21; port++) {
+    double temperature = pros::c::motor_get_temperature(port);
+    if (temperature != PROS_ERR_F) {
+      Debugger::respond("Port %d: motor, %.0f C", port, temperature);
+      found++;
+    }
+  }
+  Debugger::respond("%d motors found", found);
+}
+
+void Debugger::drive(int, char **) {
+  // The names of each role
+  static const char * names[E_MOTOR_ROLE_COUNT] = {"Front Left", "Back Left", "Front Right", "Back Right", "Other Left", "Other Right"};
+
+  // Shows each drive motor by its role, as drive motors do not know their port
+  MotorGroup * motors = ports::driveControl->getMotors();
+  for (int i = 0; i < motors->size(); i++) {
+    pros::Motor * motor = motors->get(i);
+    Debugger::respond("%s: position %.1f, velocity %.1f, current %ld mA, %.0f C", names[motors->getRole(i)], motor->get_position(), motor->get_actual_velocity(), (long) motor->get_current_draw(), motor->get_temperature());
+  }
+  Debugger::respond("Drive motor writes: %lu sent, %lu saved", (unsigned long) MotorGroup::getWritesSent(), (unsigned long) MotorGroup::getWritesSaved());
+}
+
+void Debugger::freeze(int, char **) {
+  // Pauses the operator control loop, which stops the drive itself as only one task may post drive commands
+  // Autonomous does not check the flag, so a running autonomous routine is not paused
+  runOperatorControlLoop = false;
+  Debugger::respond("Operator control frozen, autonomous is not paused");
+}
+
+void Debugger::unfreeze(int, char **) {
+  // Resumes the operator control loop
+  runOperatorControlLoop = true;
+  Debugger::respond("Operator control unfrozen");
+}
+
+void Debugger::get(int argc, char ** argv) {
+  // Lists the tunables whose names start with the prefix, or every tunable without one
+  const char * prefix = argc > 1 ? argv[1] : "";
+  int found = 0;
+  for (int i = 0; i < Tunables::size(); i++)
+    if (Tunables::getName(i)[0] != '\0' && strncmp(Tunables::getName(i), prefix, strlen(prefix)) == 0) {
+      Debugger::respond("%s = %g", Tunables::getName(i), Tunables::get(i));
+      found++;
+    }
+  if (found == 0)
+    Debugger::respond("No tunables start with %s", prefix);
+  else if (Tunables::isPending())
+    Debugger::respond("Changes have not yet been applied");
+}
+
+void Debugger::set(int argc, char ** argv) {
+  if (argc < 3) {
+    Debugger::respond("Expected a tunable and a value");
+    return;
+  }
+  int index = Tunables::find(argv[1]);
+  if (index < 0) {
+    Debugger::respond("Unknown tunable: %s", argv[1]);
+    return;
+  }
+  char * end;
+  double value = strtod(argv[2], &end);
+  if (*end != '\0') {
+    Debugger::respond("Expected a number: %s", argv[2]);
+    return;
+  }
+
+  // Stage the value, applied by the task running the drive between its calculations
+  double previous = Tunables::get(index);
+  Tunables::begin();
+  Tunables::set(index, value);
+  Tunables::end();
+  Debugger::respond("%s = %g, was %g", Tunables::getName(index), Tunables::get(index), previous);
+}
+
+void Debugger::save(int, char **) {
+  // Writes the staged values, which the next start applies if TUNABLES_LOAD_SAVED is set
+  if (Tunables::save(TUNABLES_PATH))
+    Debugger::respond("Saved %d tunables to %s", Tunables::size(), TUNABLES_PATH);
+  else
+    Debugger::respond("Could not write %s", TUNABLES_PATH);
+}
+
+void Debugger::load(int, char **) {
+  // Stages the saved values
+  if (Tunables::load(TUNABLES_PATH))
+    Debugger::respond("Loaded the tunables from %s", TUNABLES_PATH);
+  else
+    Debugger::respond("Could not read %s", TUNABLES_PATH);
+}
@@ -1,94 +1,239 @@
 #include "main.h"
+#include <climits>
 #include <cmath>
 #include <vector>
 #include "drive.hpp"
 
-void DriveControl::runLeftMotors(int voltage) {
-  // Iterate through and set the left motors to a given power
-  for (const auto & motor : DriveControl::otherLeftMotors)
-    motor->move(voltage);
-  for (const auto & motor : DriveControl::frontLeftMotors)
-    motor->move(voltage);
-  for (const auto & motor : DriveControl::backLeftMotors)
-    motor->move(voltage);
+std::uint32_t MotorGroup::sent = 0;
+std::uint32_t MotorGroup::saved = 0;
+
+MotorGroup::MotorGroup() {
+  // The group starts empty
+  MotorGroup::count = 0;
+}
+
+bool MotorGroup::isLeft(motor_role role) {
+  // Returns whether the role is on the left side
+  return role == E_MOTOR_FRONT_LEFT || role == E_MOTOR_BACK_LEFT || role == E_MOTOR_OTHER_LEFT;
+}
+
+motor_role MotorGroup::otherRole(motor_role role) {
+  // Returns the other role on the same side
+  return isLeft(role) ? E_MOTOR_OTHER_LEFT : E_MOTOR_OTHER_RIGHT;
+}
+
+bool MotorGroup::add(pros::Motor * motor, motor_role role) {
+  // Add the motor to the end of the group, if there is room
+  if (MotorGroup::count >= MAX_MOTORS)
+    return false;
+  MotorGroup::motors[count] = motor;
+  MotorGroup::roles[count] = role;
+  MotorGroup::invalidate(count);
+  MotorGroup::count++;
+  return true;
+}
+
+void MotorGroup::clear() {
+  // Empty the group
+  MotorGroup::count = 0;
+}
+
+void MotorGroup::clear(motor_role role) {
+  // Shift the motors without the given role down over the removed motors, keeping their order
+  int kept = 0;
+  for (int i = 0; i < MotorGroup::count; i++)
+    if (MotorGroup::roles[i] != role) {
+      MotorGroup::motors[kept] = MotorGroup::motors[i];
+      MotorGroup::roles[kept] = MotorGroup::roles[i];
+      MotorGroup::powers[kept] = MotorGroup::powers[i];
+      MotorGroup::powerSkips[kept] = MotorGroup::powerSkips[i];
+      MotorGroup::brakes[kept] = MotorGroup::brakes[i];
+      MotorGroup::brakeSkips[kept] = MotorGroup::brakeSkips[i];
+      MotorGroup::units[kept] = MotorGroup::units[i];
+      MotorGroup::unitSkips[kept] = MotorGroup::unitSkips[i];
+      kept++;
+    }
+  MotorGroup::count = kept;
+}
+
+int MotorGroup::size() {
+  // Returns the amount of motors
+  return MotorGroup::count;
+}
+
+int MotorGroup::size(motor_role role) {
+  // Counts the motors with the given role
+  int size = 0;
+  for (int i = 0; i < MotorGroup::count; i++)
+    if (MotorGroup::roles[i] == role)
+      size++;
+  return size;
+}
+
+pros::Motor * MotorGroup::get(int index) {
+  // Returns the motor at the index, if there is one
+  if (index < 0 || index >= MotorGroup::count)
+    return NULL;
+  return MotorGroup::motors[index];
+}
+
+motor_role MotorGroup::getRole(int index) {
+  // Returns the role of the motor at the index
+  return MotorGroup::roles[index];
+}
+
+bool MotorGroup::update(int & cached, int value, int & skips) {
+  // Skip the write if the value is unchanged and has not been skipped too many times in a row
+  if (cached == value && skips < REFRESH_SKIPS) {
+    skips++;
+    saved++;
+    return false;
+  }
+  cached = value;
+  skips = 0;
+  sent++;
+  return true;
+}
+
+void MotorGroup::invalidate(int index) {
+  // Use values no write can have, so the next write of each kind is sent
+  MotorGroup::powers[index] = INT_MIN;
+  MotorGroup::powerSkips[index] = 0;
+  MotorGroup::brakes[index] = -1;
+  MotorGroup::brakeSkips[index] = 0;
+  MotorGroup::units[index] = -1;
+  MotorGroup::unitSkips[index] = 0;
+}
+
+void MotorGroup::move(const int powers[E_MOTOR_ROLE_COUNT]) {
+  // Run each motor at its role's power, if it is not already
+  for (int i = 0; i < MotorGroup::count; i++)
+    if (update(MotorGroup::powers[i], powers[roles[i]], MotorGroup::powerSkips[i]))
+      MotorGroup::motors[i]->move(powers[roles[i]]);
+}
+
+void MotorGroup::move(int power) {
+  // Run every motor at the given power, if it is not already
+  for (int i = 0; i < MotorGroup::count; i++)
+    if (update(MotorGroup::powers[i], power, MotorGroup::powerSkips[i]))
+      MotorGroup::motors[i]->move(power);
+}
+
+void MotorGroup::moveRelative(const int degrees[E_MOTOR_ROLE_COUNT], int velocity) {
+  // Move each motor its role's amount of degrees. Position moves are always sent, and replace the last power sent
+  for (int i = 0; i < MotorGroup::count; i++) {
+    MotorGroup::motors[i]->move_relative(degrees[roles[i]], velocity);
+    MotorGroup::powers[i] = INT_MIN;
+    sent++;
+  }
 }
 
-void DriveControl::runRightMotors(int voltage) {
-  // Iterate through and set the right motors to a given power
-  for (const auto & motor : DriveControl::otherRightMotors)
-    motor->move(voltage);
-  for (const auto & motor : DriveControl::frontRightMotors)
-    motor->move(voltage);
-  for (const auto & motor : DriveControl::backRightMotors)
-    motor->move(voltage);
+void MotorGroup::setBrake(const pros::motor_brake_mode_e_t modes[E_MOTOR_ROLE_COUNT]) {
+  // Set each motor to its role's brake mode, if it is not already
+  for (int i = 0; i < MotorGroup::count; i++)
+    if (update(MotorGroup::brakes[i], modes[roles[i]], MotorGroup::brakeSkips[i]))
+      MotorGroup::motors[i]->set_brake_mode(modes[roles[i]]);
 }
 
-void DriveControl::runFrontLeftMotors(int power) {
-  // Iterates and runs the front left motors at a given power
-    for (const auto & motor : DriveControl::frontLeftMotors)
-      motor->move(power);
+void MotorGroup::setBrake(pros::motor_brake_mode_e_t mode) {
+  // Set every motor to the given brake mode, if it is not already
+  for (int i = 0; i < MotorGroup::count; i++)
+    if (update(MotorGroup::brakes[i], mode, MotorGroup::brakeSkips[i]))
+      MotorGroup::motors[i]->set_brake_mode(mode);
 }
 
-void DriveControl::runBackLeftMotors(int power) {
-  // Iterates and runs the back left motors at a given power
-    for (const auto & motor : DriveControl::backLeftMotors)
-      motor->move(power);
+void MotorGroup::tare(int disconnected[2]) {
+  disconnected[0] = 0;
+  disconnected[1] = 0;
+
+  // Zero each motor in degrees, counting the motors reporting an impossible efficiency as disconnected
+  for (int i = 0; i < MotorGroup::count; i++) {
+    pros::Motor * motor = MotorGroup::motors[i];
+    motor->tare_position();
+    if (update(MotorGroup::units[i], ENCODER_DEGREES, MotorGroup::unitSkips[i]))
+      motor->set_encoder_units(ENCODER_DEGREES);
+    if (motor->get_efficiency() > 1000)
+      disconnected[isLeft(roles[i]) ? 0 : 1]++;
+  }
 }
 
-void DriveControl::runFrontRightMotors(int power) {
-  // Iterates and runs the front right motors at a given power
-    for (const auto & motor : DriveControl::frontRightMotors)
-      motor->move(power);
+void MotorGroup::getPositions(double positions[MAX_MOTORS]) {
+  // Read the position of each motor
+  for (int i = 0; i < MotorGroup::count; i++)
+    positions[i] = MotorGroup::motors[i]->get_position();
 }
 
-void DriveControl::runBackRightMotors(int power) {
-  // Iterates and runs the back right motors at a given power
-    for (const auto & motor : DriveControl::backRightMotors)
-      motor->move(power);
+void MotorGroup::averagePositions(double averages[E_MOTOR_ROLE_COUNT]) {
+  int sizes[E_MOTOR_ROLE_COUNT] = {};
+  for (int r = 0; r < E_MOTOR_ROLE_COUNT; r++)
+    averages[r] = 0;
+
+  // Sum the positions of each role in one pass, then divide by the amount of motors in each role
+  for (int i = 0; i < MotorGroup::count; i++) {
+    averages[roles[i]] += MotorGroup::motors[i]->get_position();
+    sizes[roles[i]]++;
+  }
+  for (int r = 0; r < E_MOTOR_ROLE_COUNT; r++)
+    if (sizes[r] > 0)
+      averages[r] /= sizes[r];
 }
 
-void DriveControl::setLeftBrake(pros::motor_brake_mode_e_t mode) {
-  // Iterate through and set the left motors to a given brake mode
-  for (const auto & motor : DriveControl::otherLeftMotors)
-    motor->set_brake_mode(mode);
-  for (const auto & motor : DriveControl::frontLeftMotors)
-    motor->set_brake_mode(mode);
-  for (const auto & motor : DriveControl::backLeftMotors)
-    motor->set_brake_mode(mode);
+void MotorGroup::invalidate() {
+  // Forget what was last sent to each motor
+  for (int i = 0; i < MotorGroup::count; i++)
+    MotorGroup::invalidate(i);
 }
 
-void DriveControl::setRightBrake(pros::motor_brake_mode_e_t mode) {
-  // Iterate through and set the right motors to a given brake mode
-  for (const auto & motor : DriveControl::otherRightMotors)
-    motor->set_brake_mode(mode);
-  for (const auto & motor : DriveControl::frontRightMotors)
-    motor->set_brake_mode(mode);
-  for (const auto & motor : DriveControl::backRightMotors)
-    motor->set_brake_mode(mode);
+void MotorGroup::recordStatus() {
+  // Record each motor's status against its role
+  for (int i = 0; i < MotorGroup::count; i++) {
+    pros::Motor * motor = MotorGroup::motors[i];
+    RecordLog::record(E_RECORD_MOTOR_STATUS, roles[i], motor->get_position(), motor->get_actual_velocity(), motor->get_current_draw(), motor->get_temperature());
+  }
 }
 
-void DriveControl::setFrontLeftBrake(pros::motor_brake_mode_e_t mode) {
-  // Iterate through and set the front left motors to a given brake mode
-  for (const auto & motor : DriveControl::frontLeftMotors)
-    motor->set_brake_mode(mode);
+std::uint32_t MotorGroup::getWritesSent() {
+  // Returns the amount of writes sent
+  return MotorGroup::sent;
 }
 
-void DriveControl::setBackLeftBrake(pros::motor_brake_mode_e_t mode) {
-  // Iterate through and set the back left motors to a given brake mode
-  for (const auto & motor : DriveControl::backLeftMotors)
-    motor->set_brake_mode(mode);
+std::uint32_t MotorGroup::getWritesSaved() {
+  // Returns the amount of writes skipped
+  return MotorGroup::saved;
 }
 
-void DriveControl::setFrontRightBrake(pros::motor_brake_mode_e_t mode) {
-  // Iterate through and set the front right motors to a given brake mode
-  for (const auto & motor : DriveControl::frontRightMotors)
-    motor->set_brake_mode(mode);
+DriveMailbox::DriveMailbox() {
+  // The mailbox starts with no command
+  DriveMailbox::command.type = E_DRIVE_COMMAND_NONE;
+  DriveMailbox::sequence = 0;
 }
 
-void DriveControl::setBackRightBrake(pros::motor_brake_mode_e_t mode) {
-  // Iterate through and set the back right motors to a given brake mode
-  for (const auto & motor : DriveControl::backRightMotors)
-    motor->set_brake_mode(mode);
+std::uint32_t DriveMailbox::post(const DriveCommand & command) {
+  // Start from the next even sequence number, in case a deleted task left a post half written
+  std::uint32_t sequence = (DriveMailbox::sequence.load(std::memory_order_relaxed) + 1) & ~1u;
+
+  // Mark the command as being written, write it, then publish it under the next even sequence number
+  DriveMailbox::sequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  DriveMailbox::command = command;
+  DriveMailbox::sequence.store(sequence + 2, std::memory_order_release);
+  return sequence + 2;
+}
+
+bool DriveMailbox::read(DriveCommand & command, std::uint32_t & sequence) {
+  // Fail if a post is being written
+  std::uint32_t before = DriveMailbox::sequence.load(std::memory_order_acquire);
+  if (before & 1)
+    return false;
+
+  // Copy the command, then fail if a post started while copying
+  DriveCommand copy = DriveMailbox::command;
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (DriveMailbox::sequence.load(std::memory_order_relaxed) != before)
+    return false;
+  command = copy;
+  sequence = before;
+  return true;
 }
 /*
 PIDCommand DriveControl::runMotorsRelative(PID * pid, PIDCalc * calc, std::vector<pros::Motor *> motors, int target) {
@@ -111,20 +256,34 @@ PIDCommand DriveControl::runMotorsRelative(PID * pid, PIDCalc * calc, std::vecto
   }
 }
 */
-DriveControl::DriveControl(pros::Mutex * motorLock, pros::Motor * leftMotor, pros::Motor * rightMotor) {
+const int DriveControl::strafeVoltages[STRAFE_TABLE_SIZE] = {-127, -96, -64, -32, 0, 32, 64, 96, 127};
+
+DriveControl::DriveControl(pros::Motor * leftMotor, pros::Motor * rightMotor) {
   // Two wheel drive initialization
-  // Store the mutex
-  DriveControl::lock = motorLock;
+  // No command has been applied
+  DriveControl::command.type = E_DRIVE_COMMAND_NONE;
+  DriveControl::applied = 0;
+  DriveControl::tared = 0;
+  DriveControl::invalidateRequested = false;
+  // Start with the default strafe compensation
+  for (int i = 0; i < STRAFE_TABLE_SIZE; i++)
+    DriveControl::strafeCompensation[i] = strafeVoltages[i] == 0 ? 0 : STRAFE_DEFAULT_COMPENSATION;
   // Add the left motor
   DriveControl::addLeftMotor(leftMotor);
   // Add the right motor
   DriveControl::addRightMotor(rightMotor);
 }
 
-DriveControl::DriveControl(pros::Mutex * motorLock, pros::Motor * frontLeftMotor, pros::Motor * rearLeftMotor, pros::Motor * frontRightMotor, pros::Motor * rearRightMotor) {
+DriveControl::DriveControl(pros::Motor * frontLeftMotor, pros::Motor * rearLeftMotor, pros::Motor * frontRightMotor, pros::Motor * rearRightMotor) {
   // Four wheel drive initialization
-  // Store the mutex
-  DriveControl::lock = motorLock;
+  // No command has been applied
+  DriveControl::command.type = E_DRIVE_COMMAND_NONE;
+  DriveControl::applied = 0;
+  DriveControl::tared = 0;
+  DriveControl::invalidateRequested = false;
+  // Start with the default strafe compensation
+  for (int i = 0; i < STRAFE_TABLE_SIZE; i++)
+    DriveControl::strafeCompensation[i] = strafeVoltages[i] == 0 ? 0 : STRAFE_DEFAULT_COMPENSATION;
   // Add the left motors
   DriveControl::addFrontLeftMotor(frontLeftMotor);
   DriveControl::addBackLeftMotor(rearLeftMotor);
@@ -157,73 +316,86 @@ void DriveControl::reinitialize(pros::Motor * frontLeftMotor, pros::Motor * rear
 
 void DriveControl::addLeftMotor(pros::Motor * motor) {
   // Add the motor to the list of left motors
-  DriveControl::otherLeftMotors.push_back(motor);
+  DriveControl::motors.add(motor, E_MOTOR_OTHER_LEFT);
 }
 
 void DriveControl::addFrontLeftMotor(pros::Motor * motor) {
   // Adds a motor to the front left motors list
-  DriveControl::frontLeftMotors.push_back(motor);
+  DriveControl::motors.add(motor, E_MOTOR_FRONT_LEFT);
 }
 
 void DriveControl::addBackLeftMotor(pros::Motor * motor) {
   // Adds a motor to the back left motors list
-  DriveControl::backLeftMotors.push_back(motor);
+  DriveControl::motors.add(motor, E_MOTOR_BACK_LEFT);
 }
 
 void DriveControl::addRightMotor(pros::Motor * motor) {
   // Add the motor to the list of right motors
-  DriveControl::otherRightMotors.push_back(motor);
+  DriveControl::motors.add(motor, E_MOTOR_OTHER_RIGHT);
 }
 
 void DriveControl::addFrontRightMotor(pros::Motor * motor) {
   // Adds a motor to the front right motors list
-  DriveControl::frontRightMotors.push_back(motor);
+  DriveControl::motors.add(motor, E_MOTOR_FRONT_RIGHT);
 }
 
 void DriveControl::addBackRightMotor(pros::Motor * motor) {
   // Adds a motor to the back right motors list
-  DriveControl::backRightMotors.push_back(motor);
+  DriveControl::motors.add(motor, E_MOTOR_BACK_RIGHT);
 }
 
 void DriveControl::clearMotors() {
-  // Clear all left motors
-  DriveControl::clearLeftMotors();
-  // Clear all right motors
-  DriveControl::clearRightMotors();
+  // Clear all motors
+  DriveControl::motors.clear();
 }
 
 void DriveControl::clearLeftMotors() {
   // Clear all left motors
-  DriveControl::otherLeftMotors.clear();
+  DriveControl::motors.clear(E_MOTOR_OTHER_LEFT);
   DriveControl::clearFrontLeftMotors();
   DriveControl::clearBackLeftMotors();
 }
 
 void DriveControl::clearRightMotors() {
   // Clear all right motors
-  DriveControl::otherRightMotors.clear();
+  DriveControl::motors.clear(E_MOTOR_OTHER_RIGHT);
   DriveControl::clearFrontRightMotors();
   DriveControl::clearBackRightMotors();
 }
 
 void DriveControl::clearFrontLeftMotors() {
   // Empty the list of front left motors
-  DriveControl::frontLeftMotors.clear();
+  DriveControl::motors.clear(E_MOTOR_FRONT_LEFT);
 }
 
 void DriveControl::clearBackLeftMotors() {
   // Empty the list of back left motors
-  DriveControl::backLeftMotors.clear();
+  DriveControl::motors.clear(E_MOTOR_BACK_LEFT);
 }
 
 void DriveControl::clearFrontRightMotors() {
   // Empty the list of front right motors
-  DriveControl::frontRightMotors.clear();
+  DriveControl::motors.clear(E_MOTOR_FRONT_RIGHT);
 }
 
 void DriveControl::clearBackRightMotors() {
   // Empty the list of back right motors
-  DriveControl::backRightMotors.clear();
+  DriveControl::motors.clear(E_MOTOR_BACK_RIGHT);
+}
+
+MotorGroup * DriveControl::getMotors() {
+  // Returns the drive motors
+  return &motors;
+}
+
+InputCurve * DriveControl::getMoveCurve() {
+  // Returns the movement response curve
+  return &moveCurve;
+}
+
+InputCurve * DriveControl::getTurnCurve() {
+  // Returns the turning response curve
+  return &turnCurve;
 }
 /*
 void DriveControl::moveRelative(int frontLeftDegrees, int backLeftDegrees, int frontRightDegrees, int backRightDegrees) {
@@ -624,22 +796,19 @@ void DriveControl::runH(double moveVoltage, double turnVoltage, bool brake, bool
   // Flip the left and right outputs if reversing, meant to better map the analog stick positions to actual robot movement
   bool flip = flipReverse && moveVoltage < MOTOR_REVERSE_FLIP_THRESHOLD;
 
-  // Multiply the voltages by the sensitivity
-  moveVoltage *= moveSensitivity;
-  turnVoltage *= turnSensitivity;
+  // Shape the voltages through the response curves, then multiply them by the sensitivity
+  moveVoltage = DriveControl::moveCurve.shape(moveVoltage) * moveSensitivity;
+  turnVoltage = DriveControl::turnCurve.shape(turnVoltage) * turnSensitivity;
 
   // Calculate the left and right outputs
   int leftVoltage = util::limit127(!flip ? moveVoltage + turnVoltage : moveVoltage - turnVoltage);
   int rightVoltage = util::limit127(!flip ? moveVoltage - turnVoltage : moveVoltage + turnVoltage);
 
-  if (lock->take(MUTEX_WAIT_TIME)) {
-    // Issue the move and brake commands to the motors
-    setLeftBrake(brake ? BRAKE_BRAKE : BRAKE_COAST);
-    setRightBrake(brake ? BRAKE_BRAKE : BRAKE_COAST);
-    runLeftMotors(leftVoltage);
-    runRightMotors(rightVoltage);
-    lock->give();
-  }
+  // The power for each motor role
+  int powers[E_MOTOR_ROLE_COUNT] = {leftVoltage, leftVoltage, rightVoltage, rightVoltage, leftVoltage, rightVoltage};
+
+  // Post the move and brake commands for the drive task
+  DriveControl::postPowers(powers, brake);
 }
 
 void DriveControl::runStrafe(double moveVoltage, double turnStrafeVoltage, bool strafe, bool brake, bool flipReverse, double moveSensitivity, double turnStrafeSensitivity) {
@@ -675,10 +844,12 @@ void DriveControl::runX(double moveVoltage, double strafeVoltage, double turnVol
     backLeftVoltage -= strafeVoltage;
     frontRightVoltage -= strafeVoltage;
     backRightVoltage += strafeVoltage;
-    frontLeftVoltage += 20;
-    backLeftVoltage += 20;
-    frontRightVoltage += 20;
-    backRightVoltage += 20;
+    // Cancel the drift at this strafe voltage
+    double compensation = DriveControl::getStrafeCompensation(strafeVoltage);
+    frontLeftVoltage += compensation;
+    backLeftVoltage += compensation;
+    frontRightVoltage += compensation;
+    backRightVoltage += compensation;
   }
   if (turnVoltage != 0) {
     if (flip) turnVoltage = -turnVoltage;
@@ -688,22 +859,171 @@ void DriveControl::runX(double moveVoltage, double strafeVoltage, double turnVol
     backRightVoltage -= turnVoltage;
   }
 
-  if (lock->take(MUTEX_WAIT_TIME)) {
-    // Issue the move and brake commands to the motors
-    setLeftBrake(brake ? BRAKE_BRAKE : BRAKE_COAST);
-    setRightBrake(brake ? BRAKE_BRAKE : BRAKE_COAST);
-    runFrontLeftMotors(frontLeftVoltage);
-    runBackLeftMotors(backLeftVoltage);
-    runFrontRightMotors(frontRightVoltage);
-    runBackRightMotors(backRightVoltage);
-    lock->give();
-  }
+  // The power for each motor role, with the other motors following the average of their side
+  int powers[E_MOTOR_ROLE_COUNT];
+  powers[E_MOTOR_FRONT_LEFT] = frontLeftVoltage;
+  powers[E_MOTOR_BACK_LEFT] = backLeftVoltage;
+  powers[E_MOTOR_FRONT_RIGHT] = frontRightVoltage;
+  powers[E_MOTOR_BACK_RIGHT] = backRightVoltage;
+  powers[E_MOTOR_OTHER_LEFT] = (frontLeftVoltage + backLeftVoltage) / 2;
+  powers[E_MOTOR_OTHER_RIGHT] = (frontRightVoltage + backRightVoltage) / 2;
+
+  // Post the move and brake commands for the drive task
+  DriveControl::postPowers(powers, brake);
 }
 
 void DriveControl::stop(bool brake) {
   DriveControl::runX(0, 0, 0, brake, false, 1.0, 1.0, 1.0);
 }
 
+int DriveControl::getStrafeTableVoltage(int index) {
+  // Returns the strafe voltage of the point
+  return strafeVoltages[index];
+}
+
+void DriveControl::setStrafeCompensation(const double compensation[STRAFE_TABLE_SIZE]) {
+  // Store the compensation of each point
+  for (int i = 0; i < STRAFE_TABLE_SIZE; i++)
+    DriveControl::strafeCompensation[i] = compensation[i];
+}
+
+double DriveControl::getStrafeTableCompensation(int index) {
+  // Returns the compensation of the point
+  return DriveControl::strafeCompensation[index];
+}
+
+double DriveControl::getStrafeCompensation(double strafeVoltage) {
+  // Beyond either end of the table, use the end point
+  if (strafeVoltage <= strafeVoltages[0])
+    return DriveControl::strafeCompensation[0];
+  if (strafeVoltage >= strafeVoltages[STRAFE_TABLE_SIZE - 1])
+    return DriveControl::strafeCompensation[STRAFE_TABLE_SIZE - 1];
+
+  // Interpolate between the points either side of the voltage
+  int i = 0;
+  while (strafeVoltage > strafeVoltages[i + 1])
+    i++;
+  double fraction = (strafeVoltage - strafeVoltages[i]) / (strafeVoltages[i + 1] - strafeVoltages[i]);
+  return DriveControl::strafeCompensation[i] + fraction * (DriveControl::strafeCompensation[i + 1] - DriveControl::strafeCompensation[i]);
+}
+
+bool DriveControl::loadStrafeCompensation(std::string path) {
+  FILE * file = fopen(path.c_str(), "r");
+  if (file == NULL)
+    return false;
+
+  // Read every point before using any, so a partial file leaves the table unchanged
+  double compensation[STRAFE_TABLE_SIZE];
+  bool complete = true;
+  for (int i = 0; i < STRAFE_TABLE_SIZE && complete; i++)
+    complete = fscanf(file, "%lf", &compensation[i]) == 1;
+  fclose(file);
+
+  if (complete)
+    DriveControl::setStrafeCompensation(compensation);
+  return complete;
+}
+
+bool DriveControl::saveStrafeCompensation(std::string path) {
+  FILE * file = fopen(path.c_str(), "w");
+  if (file == NULL)
+    return false;
+
+  // Write the compensation of each point, separated by spaces
+  for (int i = 0; i < STRAFE_TABLE_SIZE; i++)
+    fprintf(file, i == 0 ? "%.2f" : " %.2f", DriveControl::strafeCompensation[i]);
+  fprintf(file, "\n");
+  fclose(file);
+  return true;
+}
+
+void DriveControl::postPowers(const int powers[E_MOTOR_ROLE_COUNT], bool brake) {
+  // Build a power command with the same brake mode for every role and post it
+  DriveCommand command;
+  command.type = E_DRIVE_COMMAND_POWER;
+  command.velocity = 0;
+  for (int r = 0; r < E_MOTOR_ROLE_COUNT; r++) {
+    command.values[r] = powers[r];
+    command.brakes[r] = brake ? BRAKE_BRAKE : BRAKE_COAST;
+  }
+  DriveControl::post(command);
+}
+
+std::uint32_t DriveControl::post(const DriveCommand & command) {
+  // Replace the latest command
+  return DriveControl::mailbox.post(command);
+}
+
+bool DriveControl::tare(int disconnected[2]) {
+  // Post a stop which zeroes the motors as it is applied
+  DriveCommand command;
+  command.type = E_DRIVE_COMMAND_TARE;
+  command.velocity = 0;
+  for (int r = 0; r < E_MOTOR_ROLE_COUNT; r++) {
+    command.values[r] = 0;
+    command.brakes[r] = MOTOR_DEFAULT_BRAKE ? BRAKE_BRAKE : BRAKE_COAST;
+  }
+  std::uint32_t sequence = DriveControl::post(command);
+
+  // Wait for the drive task to apply it, as only the drive task writes to the motors
+  std::uint32_t start = pros::millis();
+  while (DriveControl::tared.load(std::memory_order_acquire) != sequence) {
+    if (pros::millis() - start > DRIVE_TARE_TIMEOUT)
+      return false;
+    pros::delay(DRIVE_TASK_INTERVAL);
+  }
+  disconnected[0] = DriveControl::disconnected[0];
+  disconnected[1] = DriveControl::disconnected[1];
+  return true;
+}
+
+void DriveControl::invalidate() {
+  // Request the drive task forgets the last writes, as only the drive task writes to the motor group
+  DriveControl::invalidateRequested.store(true, std::memory_order_release);
+}
+
+void DriveControl::update() {
+  // Forget the last writes if requested, before anything is written this tick
+  if (DriveControl::invalidateRequested.exchange(false, std::memory_order_acq_rel))
+    DriveControl::motors.invalidate();
+
+  // Take the latest command if it can be read, otherwise keep applying the current one
+  DriveCommand latest;
+  std::uint32_t sequence;
+  bool fresh = DriveControl::mailbox.read(latest, sequence) && sequence != DriveControl::applied;
+  if (fresh) {
+    DriveControl::command = latest;
+    DriveControl::applied = sequence;
+  }
+
+  // Tares are issued once, then hold the stop they carry
+  if (DriveControl::command.type == E_DRIVE_COMMAND_TARE && fresh) {
+    DriveControl::motors.setBrake(DriveControl::command.brakes);
+    DriveControl::motors.move(DriveControl::command.values);
+    DriveControl::motors.tare(DriveControl::disconnected);
+    DriveControl::tared.store(sequence, std::memory_order_release);
+  }
+
+  // Powers are issued every tick, as repeats are skipped by the motor group. Relative moves are only issued once
+  if (DriveControl::command.type == E_DRIVE_COMMAND_POWER || DriveControl::command.type == E_DRIVE_COMMAND_TARE) {
+    DriveControl::motors.setBrake(DriveControl::command.brakes);
+    DriveControl::motors.move(DriveControl::command.values);
+  } else if (DriveControl::command.type == E_DRIVE_COMMAND_RELATIVE && fresh) {
+    DriveControl::motors.setBrake(DriveControl::command.brakes);
+    DriveControl::motors.moveRelative(DriveControl::command.values, DriveControl::command.velocity);
+  }
+}
+
+void DriveControl::task(void * driveControl) {
+  // Issue the latest command every interval
+  DriveControl * control = (DriveControl *) driveControl;
+  std::uint32_t now = pros::millis();
+  while (true) {
+    control->update();
+    pros::Task::delay_until(&now, DRIVE_TASK_INTERVAL);
+  }
+}
+
 
 DriveFunction::DriveFunction(DriveControl * driveControl) {
   // Store the DriveControl object to wrap/call
@@ -721,6 +1041,10 @@ DriveFunction::DriveFunction(DriveControl * driveControl) {
   // Strafe value has not been set
   DriveFunction::ks = 0;
 
+  // Gyro has not been set
+  DriveFunction::gyro = NULL;
+  DriveFunction::gyroPID = NULL;
+
   // PID values have not been set
   DriveFunction::useForwardPID = false;
   DriveFunction::useBackwardPID = false;
@@ -807,6 +1131,11 @@ void DriveFunction::setForwardPID(PID * frontLeftPID, PID * backLeftPID, PID * f
   DriveFunction::forwardBackLeftPID = backLeftPID;
   DriveFunction::forwardFrontRightPID = frontRightPID;
   DriveFunction::forwardBackRightPID = backRightPID;
+  // Make the PID constants tunable over the USB debugger
+  Tunables::addPID("forward.fl", frontLeftPID);
+  Tunables::addPID("forward.bl", backLeftPID);
+  Tunables::addPID("forward.fr", frontRightPID);
+  Tunables::addPID("forward.br", backRightPID);
 }
 
 void DriveFunction::setBackwardPID(PID * frontLeftPID, PID * backLeftPID, PID * frontRightPID, PID * backRightPID) {
@@ -817,6 +1146,11 @@ void DriveFunction::setBackwardPID(PID * frontLeftPID, PID * backLeftPID, PID *
   DriveFunction::backwardBackLeftPID = backLeftPID;
   DriveFunction::backwardFrontRightPID = frontRightPID;
   DriveFunction::backwardBackRightPID = backRightPID;
+  // Make the PID constants tunable over the USB debugger
+  Tunables::addPID("backward.fl", frontLeftPID);
+  Tunables::addPID("backward.bl", backLeftPID);
+  Tunables::addPID("backward.fr", frontRightPID);
+  Tunables::addPID("backward.br", backRightPID);
 }
 
 void DriveFunction::setPivotPID(PID * frontLeftPID, PID * backLeftPID, PID * frontRightPID, PID * backRightPID) {
@@ -827,6 +1161,11 @@ void DriveFunction::setPivotPID(PID * frontLeftPID, PID * backLeftPID, PID * fro
   DriveFunction::pivotBackLeftPID = backLeftPID;
   DriveFunction::pivotFrontRightPID = frontRightPID;
   DriveFunction::pivotBackRightPID = backRightPID;
+  // Make the PID constants tunable over the USB debugger
+  Tunables::addPID("pivot.fl", frontLeftPID);
+  Tunables::addPID("pivot.bl", backLeftPID);
+  Tunables::addPID("pivot.fr", frontRightPID);
+  Tunables::addPID("pivot.br", backRightPID);
 }
 
 void DriveFunction::setStrafePID(PID * frontLeftPID, PID * backLeftPID, PID * frontRightPID, PID * backRightPID) {
@@ -837,12 +1176,21 @@ void DriveFunction::setStrafePID(PID * frontLeftPID, PID * backLeftPID, PID * fr
   DriveFunction::strafeBackLeftPID = backLeftPID;
   DriveFunction::strafeFrontRightPID = frontRightPID;
   DriveFunction::strafeBackRightPID = backRightPID;
+  // Make the PID constants tunable over the USB debugger
+  Tunables::addPID("strafe.fl", frontLeftPID);
+  Tunables::addPID("strafe.bl", backLeftPID);
+  Tunables::addPID("strafe.fr", frontRightPID);
+  Tunables::addPID("strafe.br", backRightPID);
 }
 
 void DriveFunction::clearForwardPID() {
   if (!useForwardPID)
     return;
   DriveFunction::useForwardPID = false;
+  Tunables::removePID(DriveFunction::forwardFrontLeftPID);
+  Tunables::removePID(DriveFunction::forwardBackLeftPID);
+  Tunables::removePID(DriveFunction::forwardFrontRightPID);
+  Tunables::removePID(DriveFunction::forwardBackRightPID);
   delete DriveFunction::forwardFrontLeftPID;
   delete DriveFunction::forwardBackLeftPID;
   delete DriveFunction::forwardFrontRightPID;
@@ -857,6 +1205,10 @@ void DriveFunction::clearBackwardPID() {
   if (!useBackwardPID)
     return;
   DriveFunction::useBackwardPID = false;
+  Tunables::removePID(DriveFunction::backwardFrontLeftPID);
+  Tunables::removePID(DriveFunction::backwardBackLeftPID);
+  Tunables::removePID(DriveFunction::backwardFrontRightPID);
+  Tunables::removePID(DriveFunction::backwardBackRightPID);
   delete DriveFunction::backwardFrontLeftPID;
   delete DriveFunction::backwardBackLeftPID;
   delete DriveFunction::backwardFrontRightPID;
@@ -871,6 +1223,10 @@ void DriveFunction::clearPivotPID() {
   if (!usePivotPID)
     return;
   DriveFunction::usePivotPID = false;
+  Tunables::removePID(DriveFunction::pivotFrontLeftPID);
+  Tunables::removePID(DriveFunction::pivotBackLeftPID);
+  Tunables::removePID(DriveFunction::pivotFrontRightPID);
+  Tunables::removePID(DriveFunction::pivotBackRightPID);
   delete DriveFunction::pivotFrontLeftPID;
   delete DriveFunction::pivotBackLeftPID;
   delete DriveFunction::pivotFrontRightPID;
@@ -885,6 +1241,10 @@ void DriveFunction::clearStrafePID() {
   if (!useStrafePID)
     return;
   DriveFunction::useStrafePID = false;
+  Tunables::removePID(DriveFunction::strafeFrontLeftPID);
+  Tunables::removePID(DriveFunction::strafeBackLeftPID);
+  Tunables::removePID(DriveFunction::strafeFrontRightPID);
+  Tunables::removePID(DriveFunction::strafeBackRightPID);
   delete DriveFunction::strafeFrontLeftPID;
   delete DriveFunction::strafeBackLeftPID;
   delete DriveFunction::strafeFrontRightPID;
@@ -895,76 +1255,56 @@ void DriveFunction::clearStrafePID() {
   DriveFunction::strafeBackRightPID = NULL;
 }
 
-double DriveFunction::averagePosition(std::vector<pros::Motor *> motors) {
-  double position = 0;
-  for (const auto & motor : motors)
-    position += motor->get_position();
-  return position / util::sign(motors.size());
+void DriveFunction::setGyro(pros::ADIGyro * gyro, PID * pid) {
+  if (DriveFunction::gyro != NULL)
+    DriveFunction::clearGyro();
+  DriveFunction::gyro = gyro;
+  DriveFunction::gyroPID = pid;
+  // Make the PID constants tunable over the USB debugger
+  Tunables::addPID("gyro", pid);
+}
+
+void DriveFunction::clearGyro() {
+  if (DriveFunction::gyro == NULL)
+    return;
+  Tunables::removePID(DriveFunction::gyroPID);
+  delete DriveFunction::gyro;
+  delete DriveFunction::gyroPID;
+  DriveFunction::gyro = NULL;
+  DriveFunction::gyroPID = NULL;
 }
 
 bool DriveFunction::movementReset() {
-  // The amount of disconnected motors
-  int lDisconnect = 0;
-  int rDisconnect = 0;
+  // The amount of disconnected motors on the left and right sides
+  int disconnected[2];
 
   /*
-   * Iterates through the left and right motors to check whether they are connected
+   * Zeroes the left and right motors and checks whether they are connected
    * If they are connected, proceed
-   * If not, an event is logged and the motor is temporarily removed from the list
-   * If no motors are plugged in on either side, abort
+   * If not, an event is logged
+   * If any motor is disconnected, abort
    */
-  for (const auto & motor : DriveFunction::driveControl->otherLeftMotors) {
-    motor->tare_position();
-    motor->set_encoder_units(ENCODER_DEGREES);
-    if (motor->get_efficiency() > 1000)
-      lDisconnect++;
-  }
-  for (const auto & motor : DriveFunction::driveControl->frontLeftMotors) {
-    motor->tare_position();
-    motor->set_encoder_units(ENCODER_DEGREES);
-    if (motor->get_efficiency() > 1000)
-      lDisconnect++;
-  }
-  for (const auto & motor : DriveFunction::driveControl->backLeftMotors) {
-    motor->tare_position();
-    motor->set_encoder_units(ENCODER_DEGREES);
-    if (motor->get_efficiency() > 1000)
-      lDisconnect++;
-  }
-  for (const auto & motor : DriveFunction::driveControl->otherRightMotors) {
-    motor->tare_position();
-    motor->set_encoder_units(ENCODER_DEGREES);
-    if (motor->get_efficiency() > 1000)
-      rDisconnect++;
-  }
-  for (const auto & motor : DriveFunction::driveControl->frontRightMotors) {
-    motor->tare_position();
-    motor->set_encoder_units(ENCODER_DEGREES);
-    if (motor->get_efficiency() > 1000)
-      rDisconnect++;
-  }
-  for (const auto & motor : DriveFunction::driveControl->backRightMotors) {
-    motor->tare_position();
-    motor->set_encoder_units(ENCODER_DEGREES);
-    if (motor->get_efficiency() > 1000)
-      rDisconnect++;
+  MotorGroup & motors = DriveFunction::driveControl->motors;
+  if (!DriveFunction::driveControl->tare(disconnected)) {
+    Logger::log(LOG_ERROR, "The drive task did not zero the drive motors! Aborting...");
+    return false;
   }
 
   // Whether to abort
   bool abort = false;
 
   // Display disconnect errors
-  if (lDisconnect > 0) {
-    int totalsize = driveControl->otherLeftMotors.size() + driveControl->frontLeftMotors.size() + driveControl->backLeftMotors.size();
-    if (totalsize == lDisconnect)
+  if (disconnected[0] > 0) {
+    int totalsize = motors.size(E_MOTOR_OTHER_LEFT) + motors.size(E_MOTOR_FRONT_LEFT) + motors.size(E_MOTOR_BACK_LEFT);
+    if (totalsize == disconnected[0])
       Logger::log(LOG_ERROR, "All of the left side drive motors have been disconnected! Aborting...");
     else
       Logger::log(LOG_ERROR, "Some of the left side drive motors have been disconnected! Aborting...");
     abort = true;
   }
-  if (rDisconnect > 0) {
-    int totalsize = driveControl->otherRightMotors.size() + driveControl->frontRightMotors.size() + driveControl->backRightMotors.size();
-    if (totalsize == rDisconnect)
+  if (disconnected[1] > 0) {
+    int totalsize = motors.size(E_MOTOR_OTHER_RIGHT) + motors.size(E_MOTOR_FRONT_RIGHT) + motors.size(E_MOTOR_BACK_RIGHT);
+    if (totalsize == disconnected[1])
       Logger::log(LOG_ERROR, "All of the right side drive motors have been disconnected! Aborting...");
     else
       Logger::log(LOG_ERROR, "Some of the right side drive motors have been disconnected! Aborting...");
@@ -973,74 +1313,44 @@ bool DriveFunction::movementReset() {
   return !abort;
 }
 
-void DriveFunction::moveRelative(bool usePID, PID * frontLeftPID, PID * backLeftPID, PID * frontRightPID, PID * backRightPID, int frontLeftDegrees, int backLeftDegrees, int frontRightDegrees, int backRightDegrees) {
+void DriveFunction::moveRelative(bool usePID, PID * frontLeftPID, PID * backLeftPID, PID * frontRightPID, PID * backRightPID, int frontLeftDegrees, int backLeftDegrees, int frontRightDegrees, int backRightDegrees, bool strafe) {
   // If resetting failed, exit this call
   if (!movementReset()) return;
 
+  MotorGroup & motors = driveControl->motors;
+  RecordLog::record(E_RECORD_MOVEMENT, usePID, frontLeftDegrees, backLeftDegrees, frontRightDegrees, backRightDegrees);
+
   // Calculate left and right averages
   int leftDegrees = (frontLeftDegrees + backLeftDegrees) / 2.0;
   int rightDegrees = (frontRightDegrees + backRightDegrees) / 2.0;
 
-  // Set the brake mode of this PID
-  driveControl->setLeftBrake((frontLeftPID == NULL || !frontLeftPID->brake) ? BRAKE_COAST : BRAKE_BRAKE);
-  driveControl->setBackLeftBrake((backLeftPID == NULL || !backLeftPID->brake) ? BRAKE_COAST : BRAKE_BRAKE);
-  driveControl->setRightBrake((frontRightPID == NULL || !frontRightPID->brake) ? BRAKE_COAST : BRAKE_BRAKE);
-  driveControl->setBackRightBrake((backRightPID == NULL || !backRightPID->brake) ? BRAKE_COAST : BRAKE_BRAKE);
+  // The target and PID of each motor role, with the other motors following the average of their side and the front PID
+  int targets[E_MOTOR_ROLE_COUNT] = {frontLeftDegrees, backLeftDegrees, frontRightDegrees, backRightDegrees, leftDegrees, rightDegrees};
+  PID * pids[E_MOTOR_ROLE_COUNT] = {frontLeftPID, backLeftPID, frontRightPID, backRightPID, frontLeftPID, frontRightPID};
+
+  // The command posted for the drive task, with the brake mode of this PID
+  DriveCommand drive;
+  for (int r = 0; r < E_MOTOR_ROLE_COUNT; r++)
+    drive.brakes[r] = (pids[r] == NULL || !pids[r]->brake) ? BRAKE_COAST : BRAKE_BRAKE;
 
   if (!usePID) {
-    // PID values have not been set, issue simple move commands
-    for (const auto & motor : driveControl->otherLeftMotors)
-      motor->move_relative(leftDegrees, MOTOR_MOVE_RELATIVE_MAX_SPEED);
-    for (const auto & motor : driveControl->otherRightMotors)
-      motor->move_relative(rightDegrees, MOTOR_MOVE_RELATIVE_MAX_SPEED);
-    for (const auto & motor : driveControl->frontLeftMotors)
-      motor->move_relative(frontLeftDegrees, MOTOR_MOVE_RELATIVE_MAX_SPEED);
-    for (const auto & motor : driveControl->frontRightMotors)
-      motor->move_relative(frontRightDegrees, MOTOR_MOVE_RELATIVE_MAX_SPEED);
-    for (const auto & motor : driveControl->backLeftMotors)
-      motor->move_relative(backLeftDegrees, MOTOR_MOVE_RELATIVE_MAX_SPEED);
-    for (const auto & motor : driveControl->backRightMotors)
-      motor->move_relative(backRightDegrees, MOTOR_MOVE_RELATIVE_MAX_SPEED);
+    // PID values have not been set, post simple move commands
+    drive.type = E_DRIVE_COMMAND_RELATIVE;
+    drive.velocity = MOTOR_MOVE_RELATIVE_MAX_SPEED;
+    for (int r = 0; r < E_MOTOR_ROLE_COUNT; r++)
+      drive.values[r] = targets[r];
+    driveControl->post(drive);
 
     // Loop and check for completion
+    double positions[MotorGroup::MAX_MOTORS];
     while (true) {
       bool done = true;
 
-      // Check the other left motors for completion
-      for (const auto & motor : driveControl->otherLeftMotors) {
-        if (util::abs(leftDegrees - motor->get_position()) > MOTOR_MOVE_RELATIVE_THRESHOLD)
+      // Check every motor for completion against its role's target
+      motors.getPositions(positions);
+      for (int i = 0; i < motors.size(); i++)
+        if (util::abs(targets[motors.getRole(i)] - positions[i]) > MOTOR_MOVE_RELATIVE_THRESHOLD)
           done = false;
-      }
-
-      // Check the other right motors for completion
-      for (const auto & motor : driveControl->otherRightMotors) {
-        if (util::abs(rightDegrees - motor->get_position()) > MOTOR_MOVE_RELATIVE_THRESHOLD)
-          done = false;
-      }
-
-      // Check the front left motors for completion
-      for (const auto & motor : driveControl->frontLeftMotors) {
-        if (util::abs(frontLeftDegrees - motor->get_position()) > MOTOR_MOVE_RELATIVE_THRESHOLD)
-          done = false;
-      }
-
-      // Check the front right motors for completion
-      for (const auto & motor : driveControl->frontRightMotors) {
-        if (util::abs(frontRightDegrees - motor->get_position()) > MOTOR_MOVE_RELATIVE_THRESHOLD)
-          done = false;
-      }
-
-      // Check the back left motors for completion
-      for (const auto & motor : driveControl->backLeftMotors) {
-        if (util::abs(backLeftDegrees - motor->get_position()) > MOTOR_MOVE_RELATIVE_THRESHOLD)
-          done = false;
-      }
-
-      // Check the back right motors for completion
-      for (const auto & motor : driveControl->backRightMotors) {
-        if (util::abs(backRightDegrees - motor->get_position()) > MOTOR_MOVE_RELATIVE_THRESHOLD)
-          done = false;
-      }
 
       // If done, exit the loop
       if (done) break;
@@ -1049,214 +1359,227 @@ void DriveFunction::moveRelative(bool usePID, PID * frontLeftPID, PID * backLeft
       pros::delay(20);
     }
 
-    // Stop the motors together
-    driveControl->runLeftMotors(0);
-    driveControl->runRightMotors(0);
+    // Stop the motors together, keeping the brake mode of this PID
+    drive.type = E_DRIVE_COMMAND_POWER;
+    drive.velocity = 0;
+    for (int r = 0; r < E_MOTOR_ROLE_COUNT; r++)
+      drive.values[r] = 0;
+    driveControl->post(drive);
     // Log the completion
     LCD::setStatus("Movement Complete");
     Logger::log(LOG_INFO, "Movement Complete");
+    motors.recordStatus();
   } else {
-    // Create calculation classes
-    PIDCalc * frontLeftPIDCalc = new PIDCalc();
-    PIDCalc * backLeftPIDCalc = new PIDCalc();
-    PIDCalc * frontRightPIDCalc = new PIDCalc();
-    PIDCalc * backRightPIDCalc = new PIDCalc();
-    PIDCalc * otherLeftPIDCalc = new PIDCalc();
-    PIDCalc * otherRightPIDCalc = new PIDCalc();
-    // Check whether to move the motors
-    bool frontLeftComplete = frontLeftDegrees == 0;
-    bool backLeftComplete = backLeftDegrees == 0;
-    bool frontRightComplete = frontRightDegrees == 0;
-    bool backRightComplete = backRightDegrees == 0;
-    bool otherLeftComplete = leftDegrees == 0;
-    bool otherRightComplete = rightDegrees == 0;
-    int frontLeftPower = 0;
-    int backLeftPower = 0;
-    int frontRightPower = 0;
-    int backRightPower = 0;
-    int otherLeftPower = 0;
-    int otherRightPower = 0;
-
-    // Completion string
+    // The names of each role for logging, and the codes added to the completion message
+    static const char * names[E_MOTOR_ROLE_COUNT] = {"Front Left", "Back Left", "Front Right", "Back Right", "Other Left", "Other Right"};
+    static const char * codes[E_MOTOR_ROLE_COUNT] = {"FL", "BL", "FR", "BR", "OL", "OR"};
+
+    // The channel of each role in the PID group, -1 for roles without motors, and the powers and positions of each role and channel
+    PIDGroup & group = DriveFunction::pidGroup;
+    int channels[E_MOTOR_ROLE_COUNT];
+    int powers[E_MOTOR_ROLE_COUNT];
+    double positions[E_MOTOR_ROLE_COUNT];
+    int channelPowers[PIDGroup::MAX_CHANNELS];
+    double channelPositions[PIDGroup::MAX_CHANNELS];
+
+    // Add a channel for each role with motors. Roles without a target start complete, but still hold their position
+    group.clear();
+    for (int r = 0; r < E_MOTOR_ROLE_COUNT; r++)
+      channels[r] = motors.size((motor_role) r) > 0 ? group.add(pids[r], targets[r]) : -1;
+
+    // Whether the completion of each role has been reported
+    bool reported[E_MOTOR_ROLE_COUNT];
+    for (int r = 0; r < E_MOTOR_ROLE_COUNT; r++)
+      reported[r] = channels[r] < 0 || group.isComplete(channels[r]);
+
+    // Completion string, and the start of the movement for recording how long each role took
     std::string message;
-    while (!(frontLeftComplete && backLeftComplete && frontRightComplete && backRightComplete)) {
-      // Calculate individual powers for each side
-
-      if (driveControl->frontLeftMotors.size() != 0) {
-        // Calculate a power for the front left motors
-        PIDCommand frontLeft = frontLeftPID->calculate(frontLeftPIDCalc, averagePosition(driveControl->frontLeftMotors), frontLeftDegrees);
-        frontLeftPower = frontLeft.result;
-
-        if (!frontLeftComplete) {
-          // Front left side is not complete, check for completion signal
-          if (frontLeft.type == E_COMMAND_EXIT_FAILURE || frontLeft.type == E_COMMAND_EXIT_SUCCESS) {
-            // An exit command was issued, signifying either success or failure
-            if (frontLeft.type == E_COMMAND_EXIT_FAILURE) {
-              // Front left side failed to complete, stuck on an object
-              message += "FLF";
-              Logger::log(LOG_WARNING, "Front Left has existed with a failure status! Threshold: " + std::to_string(frontLeftPID->dThreshold) + ", Error: " + std::to_string(frontLeftPIDCalc->lastError));
-            } else {
-              // Front left side successfully completed
-              message += "FLS";
-              Logger::log(LOG_INFO, "Front Left has existed with a success status. Error: " + std::to_string(frontLeftPIDCalc->lastError));
-            }
-            frontLeftComplete = true;
-          }
+    std::uint32_t start = pros::millis();
+    while (!group.isComplete()) {
+      // Apply any changes to the tunables between calculations
+      Tunables::apply();
+
+      // Calculate the power of each role from the average position of its motors
+      motors.averagePositions(positions);
+      for (int r = 0; r < E_MOTOR_ROLE_COUNT; r++)
+        if (channels[r] >= 0)
+          channelPositions[channels[r]] = positions[r];
+      group.calculate(channelPositions, channelPowers, pros::millis());
+
+      for (int r = 0; r < E_MOTOR_ROLE_COUNT; r++) {
+        powers[r] = channels[r] >= 0 ? channelPowers[channels[r]] : 0;
+
+        // Report the roles which have just completed
+        if (reported[r] || !group.isComplete(channels[r]))
+          continue;
+        if (group.getStatus(channels[r]) == E_COMMAND_EXIT_FAILURE) {
+          // The role failed to complete, stuck on an object
+          message += std::string(codes[r]) + "F";
+          Logger::log(LOG_WARNING, std::string(names[r]) + " has existed with a failure status! Threshold: " + std::to_string(pids[r]->dThreshold) + ", Error: " + std::to_string(group.getError(channels[r])));
+        } else {
+          // The role successfully completed
+          message += std::string(codes[r]) + "S";
+          Logger::log(LOG_INFO, std::string(names[r]) + " has existed with a success status. Error: " + std::to_string(group.getError(channels[r])));
         }
+        RecordLog::record(E_RECORD_PID_COMPLETE, r, group.getStatus(channels[r]), group.getError(channels[r]), pros::millis() - start, targets[r]);
+        reported[r] = true;
       }
 
-      if (driveControl->frontRightMotors.size() != 0) {
-        // Calculate a power for the front left motors
-        PIDCommand frontRight = frontRightPID->calculate(frontRightPIDCalc, averagePosition(driveControl->frontRightMotors), frontRightDegrees);
-        frontRightPower = frontRight.result;
-
-        if (!frontRightComplete) {
-          // Front right side is not complete, check for completion signal
-          if (frontRight.type == E_COMMAND_EXIT_FAILURE || frontRight.type == E_COMMAND_EXIT_SUCCESS) {
-            // An exit command was issued, signifying either success or failure
-            if (frontRight.type == E_COMMAND_EXIT_FAILURE) {
-              // Front right side failed to complete, stuck on an object
-              message += "FRF";
-              Logger::log(LOG_WARNING, "Front Right has existed with a failure status! Threshold: " + std::to_string(frontRightPID->dThreshold) + ", Error: " + std::to_string(frontRightPIDCalc->lastError));
-            } else {
-              // Front right side successfully completed
-              message += "FRS";
-              Logger::log(LOG_INFO, "Front Right has existed with a success status. Error: " + std::to_string(frontRightPIDCalc->lastError));
-            }
-            frontRightComplete = true;
-          }
-        }
+      // When strafing, cancel the drift of the strafing part of the powers, as runX does. The table was only measured for strafes
+      int compensation = 0;
+      if (strafe) {
+        double strafeVoltage = (powers[E_MOTOR_FRONT_LEFT] - powers[E_MOTOR_BACK_LEFT] - powers[E_MOTOR_FRONT_RIGHT] + powers[E_MOTOR_BACK_RIGHT]) / 4.0;
+        compensation = std::lround(driveControl->getStrafeCompensation(strafeVoltage));
       }
 
-      if (driveControl->backLeftMotors.size() != 0) {
-        // Calculate a power for the back left motors
-        PIDCommand backLeft = backLeftPID->calculate(backLeftPIDCalc, averagePosition(driveControl->backLeftMotors), backLeftDegrees);
-        backLeftPower = backLeft.result;
+      // Post the commands for the drive task
+      drive.type = E_DRIVE_COMMAND_POWER;
+      drive.velocity = 0;
+      for (int r = 0; r < E_MOTOR_ROLE_COUNT; r++)
+        drive.values[r] = util::limit127(powers[r] + compensation);
+      driveControl->post(drive);
 
-        if (!backLeftComplete) {
-          // Back left side is not complete, check for completion signal
-          if (backLeft.type == E_COMMAND_EXIT_FAILURE || backLeft.type == E_COMMAND_EXIT_SUCCESS) {
-            // An exit command was issued, signifying either success or failure
-            if (backLeft.type == E_COMMAND_EXIT_FAILURE) {
-              // Back left side failed to complete, stuck on an object
-              message += "FLF";
-              Logger::log(LOG_WARNING, "Back Left has existed with a failure status! Threshold: " + std::to_string(backLeftPID->dThreshold) + ", Error: " + std::to_string(backLeftPIDCalc->lastError));
-            } else {
-              // Back left side successfully completed
-              message += "FLS";
-              Logger::log(LOG_INFO, "Back Left has existed with a success status. Error: " + std::to_string(backLeftPIDCalc->lastError));
-            }
-            backLeftComplete = true;
-          }
-        }
-      }
+      // Delay until the next channel is due
+      pros::delay(group.getInterval());
+    }
+    // Stop the motors together, keeping the brake mode of this PID
+    drive.type = E_DRIVE_COMMAND_POWER;
+    drive.velocity = 0;
+    for (int r = 0; r < E_MOTOR_ROLE_COUNT; r++)
+      drive.values[r] = 0;
+    driveControl->post(drive);
+    // Log the completion
+    LCD::setStatus("PID Complete " + message);
+    Logger::log(LOG_INFO, "PID Complete");
+    motors.recordStatus();
+  }
+}
 
-      if (driveControl->backRightMotors.size() != 0) {
-        // Calculate a power for the back left motors
-        PIDCommand backRight = backRightPID->calculate(backRightPIDCalc, averagePosition(driveControl->backRightMotors), backRightDegrees);
-        backRightPower = backRight.result;
+void DriveFunction::pivotGyro(int degrees) {
+  // If resetting failed, exit this call
+  if (!movementReset()) return;
 
-        if (!backRightComplete) {
-          // Back right side is not complete, check for completion signal
-          if (backRight.type == E_COMMAND_EXIT_FAILURE || backRight.type == E_COMMAND_EXIT_SUCCESS) {
-            // An exit command was issued, signifying either success or failure
-            if (backRight.type == E_COMMAND_EXIT_FAILURE) {
-              // Back right side failed to complete, stuck on an object
-              message += "FRF";
-              Logger::log(LOG_WARNING, "Back Right has existed with a fai lure status! Threshold: " + std::to_string(backRightPID->dThreshold) + ", Error: " + std::to_string(backRightPIDCalc->lastError));
-            } else {
-              // Back right side successfully completed
-              message += "FRS";
-              Logger::log(LOG_INFO, "Back Right has existed with a success status. Error: " + std::to_string(backRightPIDCalc->lastError));
-            }
-            backRightComplete = true;
-          }
-        }
-      }
+  // Turn relative to the current heading, in tenths of a degree
+  double start = DriveFunction::gyro->get_value();
+  int target = degrees * 10;
+
+  // The command posted for the drive task, with the brake mode of the heading PID
+  DriveCommand drive;
+  drive.type = E_DRIVE_COMMAND_POWER;
+  drive.velocity = 0;
+  for (int r = 0; r < E_MOTOR_ROLE_COUNT; r++)
+    drive.brakes[r] = DriveFunction::gyroPID->brake ? BRAKE_BRAKE : BRAKE_COAST;
+
+  PIDCalc calc = PIDCalc();
+  std::uint32_t startTime = pros::millis();
+  while (true) {
+    // Apply any changes to the tunables between calculations
+    Tunables::apply();
+
+    // Calculate the turning power from the heading turned so far
+    PIDCommand command = DriveFunction::gyroPID->calculate(&calc, DriveFunction::gyro->get_value() - start, target);
+    // Give up if the pivot has run too long, such as when the robot is pinned or the gyro has stopped reporting
+    if (command.type == E_COMMAND_CONTINUE && pros::millis() - startTime > PIVOT_GYRO_TIMEOUT) {
+      command.type = E_COMMAND_EXIT_FAILURE;
+      Logger::log(LOG_WARNING, "Pivot timed out after " + std::to_string(PIVOT_GYRO_TIMEOUT) + " ms");
+    }
+    if (command.type == E_COMMAND_EXIT_FAILURE || command.type == E_COMMAND_EXIT_SUCCESS)
+      // Record the heading as the role after the drive motors
+      RecordLog::record(E_RECORD_PID_COMPLETE, E_MOTOR_ROLE_COUNT, command.type, calc.lastError, pros::millis() - startTime, target);
+    if (command.type == E_COMMAND_EXIT_FAILURE) {
+      LCD::setStatus("Pivot Failed");
+      Logger::log(LOG_WARNING, "Pivot has exited with a failure status! Error: " + std::to_string(calc.lastError / 10.0) + " degrees");
+      break;
+    } else if (command.type == E_COMMAND_EXIT_SUCCESS) {
+      LCD::setStatus("Pivot Complete");
+      Logger::log(LOG_INFO, "Pivot has exited with a success status. Error: " + std::to_string(calc.lastError / 10.0) + " degrees");
+      break;
+    }
 
-      if (driveControl->otherLeftMotors.size() != 0) {
-        // Calculate a power for the other left motors
-        PIDCommand otherLeft = frontLeftPID->calculate(otherLeftPIDCalc, averagePosition(driveControl->otherLeftMotors), leftDegrees);
-        otherLeftPower = otherLeft.result;
+    // Post the left side forward and the right side backward for the drive task
+    for (int r = 0; r < E_MOTOR_ROLE_COUNT; r++)
+      drive.values[r] = MotorGroup::isLeft((motor_role) r) ? command.result : -command.result;
+    DriveFunction::driveControl->post(drive);
 
-        if (!otherLeftComplete) {
-          // Other left side is not complete, check for completion signal
-          if (otherLeft.type == E_COMMAND_EXIT_FAILURE || otherLeft.type == E_COMMAND_EXIT_SUCCESS) {
-            // An exit command was issued, signifying either success or failure
-            if (otherLeft.type == E_COMMAND_EXIT_FAILURE) {
-              // Other left side failed to complete, stuck on an object
-              message += "OLF";
-              Logger::log(LOG_WARNING, "Other Left has existed with a failure status! Threshold: " + std::to_string(frontLeftPID->dThreshold) + ", Error: " + std::to_string(otherLeftPIDCalc->lastError));
-            } else {
-              // Other left side successfully completed
-              message += "OLS";
-              Logger::log(LOG_INFO, "Other Left has existed with a success status. Error: " + std::to_string(otherLeftPIDCalc->lastError));
-            }
-            otherLeftComplete = true;
-          }
-        }
-      }
+    pros::delay(DriveFunction::gyroPID->dt);
+  }
 
-      if (driveControl->otherRightMotors.size() != 0) {
-        // Calculate a power for the other left motors
-        PIDCommand otherRight = frontRightPID->calculate(otherRightPIDCalc, averagePosition(driveControl->otherRightMotors), rightDegrees);
-        otherRightPower = otherRight.result;
+  // Stop the motors together, keeping the brake mode of the heading PID
+  for (int r = 0; r < E_MOTOR_ROLE_COUNT; r++)
+    drive.values[r] = 0;
+  DriveFunction::driveControl->post(drive);
+}
 
-        if (!otherRightComplete) {
-          // Other right side is not complete, check for completion signal
-          if (otherRight.type == E_COMMAND_EXIT_FAILURE || otherRight.type == E_COMMAND_EXIT_SUCCESS) {
-            // An exit command was issued, signifying either success or failure
-            if (otherRight.type == E_COMMAND_EXIT_FAILURE) {
-              // Other right side failed to complete, stuck on an object
-              message += "ORF";
-              Logger::log(LOG_WARNING, "Other Right has existed with a failure status! Threshold: " + std::to_string(frontRightPID->dThreshold) + ", Error: " + std::to_string(otherRightPIDCalc->lastError));
-            } else {
-              // Other right side successfully completed
-              message += "ORS";
-              Logger::log(LOG_INFO, "Other Right has existed with a success status. Error: " + std::to_string(otherRightPIDCalc->lastError));
-            }
-            otherRightComplete = true;
-          }
-        }
-      }
+double DriveFunction::measureForward(int moveVoltage, int strafeVoltage) {
+  // If resetting failed, there is nothing to measure
+  if (!movementReset()) return 0;
 
-      if (driveControl->lock->take(MUTEX_WAIT_TIME)) {
-        // Iterate through and issue the commands to the motors
-        for (const auto & motor : driveControl->frontLeftMotors)
-          motor->move(frontLeftPower);
-        for (const auto & motor : driveControl->frontRightMotors)
-          motor->move(frontRightPower);
-        for (const auto & motor : driveControl->backLeftMotors)
-          motor->move(backLeftPower);
-        for (const auto & motor : driveControl->backRightMotors)
-          motor->move(backRightPower);
-        for (const auto & motor : driveControl->otherLeftMotors)
-          motor->move(otherLeftPower);
-        for (const auto & motor : driveControl->otherRightMotors)
-          motor->move(otherRightPower);
-        driveControl->lock->give();
-      }
+  // Drive for the calibration time
+  std::uint32_t start = pros::millis();
+  while (pros::millis() - start < STRAFE_CALIBRATION_TIME) {
+    DriveFunction::driveControl->runX(moveVoltage, strafeVoltage, 0, true, false, 1.0, 1.0, 1.0);
+    pros::delay(20);
+  }
+  DriveFunction::driveControl->stop(true);
+
+  // The forward movement is the average of every motor, as strafing turns the wheels on each side opposite ways
+  MotorGroup & motors = DriveFunction::driveControl->motors;
+  double positions[MotorGroup::MAX_MOTORS];
+  double forward = 0;
+  motors.getPositions(positions);
+  for (int i = 0; i < motors.size(); i++)
+    forward += positions[i];
+  forward /= util::sign(motors.size());
+
+  // Let the robot settle before the next measurement
+  pros::delay(500);
+  return forward;
+}
+
+void DriveFunction::calibrateStrafe() {
+  LCD::setStatus("Calibrating strafe");
+  Logger::log(LOG_INFO, "Calibrating strafe compensation");
+
+  // Measure how far the robot drives forward for each volt, to convert drift into the voltage cancelling it
+  double perVolt = DriveFunction::measureForward(STRAFE_CALIBRATION_VOLTAGE, 0) / STRAFE_CALIBRATION_VOLTAGE;
+  if (util::abs(perVolt) < 0.01) {
+    LCD::setStatus("Strafe calibration failed");
+    Logger::log(LOG_ERROR, "The robot did not move forward during strafe calibration! Aborting...");
+    return;
+  }
 
-      // Delay for the average time delta across all PID constants
-      pros::delay((frontLeftPID->dt + backLeftPID->dt + frontRightPID->dt + backRightPID->dt) / 4.0);
+  // Strafe at each point of the table, alternating directions and working outwards so the robot stays near its start
+  const int center = DriveControl::STRAFE_TABLE_SIZE / 2;
+  double compensation[DriveControl::STRAFE_TABLE_SIZE];
+  for (int i = 0; i < DriveControl::STRAFE_TABLE_SIZE; i++)
+    compensation[i] = DriveFunction::driveControl->getStrafeTableCompensation(i);
+  for (int k = 1; k <= center; k++)
+    for (int index : {center + k, center - k}) {
+      int strafeVoltage = DriveControl::getStrafeTableVoltage(index);
+      double drift = DriveFunction::measureForward(0, strafeVoltage);
+
+      // Correct the point by the voltage which would cancel the remaining drift
+      compensation[index] -= drift / perVolt;
+      Logger::log(LOG_INFO, "Strafe calibration - \tStrafe: " + std::to_string(strafeVoltage) + "\tDrift: " + std::to_string(drift) + "\tCompensation: " + std::to_string(compensation[index]));
     }
-    // Stop the motors together
-    driveControl->runLeftMotors(0);
-    driveControl->runRightMotors(0);
-    // Log the completion
-    LCD::setStatus("PID Complete " + message);
-    Logger::log(LOG_INFO, "PID Complete");
-    // Free up memory
-    delete frontLeftPIDCalc;
-    delete backLeftPIDCalc;
-    delete frontRightPIDCalc;
-    delete backRightPIDCalc;
-    delete otherLeftPIDCalc;
-    delete otherRightPIDCalc;
-  }
+
+  // Use the new table, and keep it for the next program start
+  DriveFunction::driveControl->setStrafeCompensation(compensation);
+  if (SD_INSERTED && !DriveFunction::driveControl->saveStrafeCompensation(STRAFE_TABLE_PATH))
+    Logger::log(LOG_WARNING, "Could not save the strafe compensation table to " + std::string(STRAFE_TABLE_PATH));
+  LCD::setStatus("Strafe calibration complete");
 }
 
 void DriveFunction::pivot(int degrees) {
+  // If a gyro has been set, turn until it reaches the heading
+  if (DriveFunction::gyro != NULL) {
+    // Display and log for debugging purposes
+    LCD::setStatus("Pivoting: " + std::to_string(degrees) + " degrees");
+    Logger::log(LOG_INFO, "Pivoting: " + std::to_string(degrees) + " degrees with the gyro");
+    DriveFunction::pivotGyro(degrees);
+    return;
+  }
+
   // Using the turn values, calculate and call the DriveControl object to move a certain amount to pivot the robot the given degrees
   int amt = 0;
   if (degrees > 0)
@@ -1269,13 +1592,13 @@ void DriveFunction::pivot(int degrees) {
   Logger::log(LOG_INFO, "Pivoting: " + std::to_string(degrees) + " degrees");
 
   // Run the drive command
-  DriveFunction::moveRelative(usePivotPID, pivotFrontLeftPID, pivotBackLeftPID, pivotFrontRightPID, pivotBackRightPID, amt, amt, -amt, -amt);
+  DriveFunction::moveRelative(usePivotPID, pivotFrontLeftPID, pivotBackLeftPID, pivotFrontRightPID, pivotBackRightPID, amt, amt, -amt, -amt, false);
 }
 
 void DriveFunction::strafe(double inches) {
   // Using the strafe value, calculate and call the DriveControl objects to strafe the given amount of inches
   double amt = DriveFunction::ks * inches;
-  DriveFunction::moveRelative(useStrafePID, strafeFrontLeftPID, strafeBackLeftPID, strafeFrontRightPID, strafeBackRightPID, -amt, amt, amt, -amt);
+  DriveFunction::moveRelative(useStrafePID, strafeFrontLeftPID, strafeBackLeftPID, strafeFrontRightPID, strafeBackRightPID, -amt, amt, amt, -amt, true);
 
   // Display and log for debugging purposes
   LCD::setStatus("Strafing: " + std::to_string(inches) + " inches");
@@ -1316,7 +1639,7 @@ void DriveFunction::moveDegrees(int degrees) {
     Logger::log(LOG_WARNING, "Drive attempted to move 0. Not moving");
   }
 
-  DriveFunction::moveRelative(usePID, frontLeftPID, backLeftPID, frontRightPID, backLeftPID, degrees, degrees, degrees, degrees);
+  DriveFunction::moveRelative(usePID, frontLeftPID, backLeftPID, frontRightPID, backRightPID, degrees, degrees, degrees, degrees, false);
 }
 
 void DriveFunction::run(double moveVoltage, double turnVoltage, bool brake, bool flipReverse) {
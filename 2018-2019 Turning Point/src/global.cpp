@@ -47,11 +47,8 @@ namespace ports {
   // Vision
   pros::Vision * flagVision = new pros::Vision(1);
 
-  // Mutexes
-  pros::Mutex * driveLock = new pros::Mutex();
-
   // Driving
-  DriveControl * driveControl = new DriveControl(ports::driveLock, ports::frontLeftDrive, ports::backLeftDrive, ports::frontRightDrive, ports::backRightDrive);
+  DriveControl * driveControl = new DriveControl(ports::frontLeftDrive, ports::backLeftDrive, ports::frontRightDrive, ports::backRightDrive);
   DriveFunction * drive = new DriveFunction(ports::driveControl);
 
 }
@@ -0,0 +1,45 @@
+#include "main.h"
+
+InputCurve::InputCurve() {
+  // Start with a linear response
+  InputCurve::configure(0, 0, 0);
+}
+
+void InputCurve::configure(int deadband, double expo, int slew) {
+  // Store the slew limit and start it from rest
+  InputCurve::slew = slew;
+  InputCurve::last = 0;
+
+  for (int i = 0; i < 256; i++) {
+    int value = util::limit127(i - 128);
+
+    // Remove the deadband and normalize what remains to a magnitude of 0 to 1
+    double magnitude = (util::abs(value) - deadband) / (127.0 - deadband);
+    if (magnitude <= 0 || deadband >= 127) {
+      InputCurve::table[i] = 0;
+      continue;
+    }
+
+    // Blend the linear and cubic responses and scale back to ±127
+    magnitude = (1 - expo) * magnitude + expo * magnitude * magnitude * magnitude;
+    InputCurve::table[i] = (value < 0 ? -1 : 1) * (int) (magnitude * 127 + 0.5);
+  }
+}
+
+int InputCurve::shape(int value) {
+  // Look up the shaped output
+  int output = InputCurve::table[(util::limit127(value) + 128) & 0xFF];
+
+  // Limit how quickly the output can grow, leaving decreases immediate. A reversal grows from 0, as the old direction has been released
+  if (output * InputCurve::last < 0)
+    InputCurve::last = 0;
+  if (InputCurve::slew > 0 && util::abs(output) > util::abs(InputCurve::last)) {
+    if (output > InputCurve::last + InputCurve::slew)
+      output = InputCurve::last + InputCurve::slew;
+    else if (output < InputCurve::last - InputCurve::slew)
+      output = InputCurve::last - InputCurve::slew;
+  }
+
+  InputCurve::last = output;
+  return output;
+}
@@ -5,11 +5,20 @@
 
 std::vector<Logger*> Logger::loggers;
 
+int Logger::logNumbers[LOGS_MAX_COUNT + 1];
+long Logger::logSizes[LOGS_MAX_COUNT + 1];
+int Logger::logCount = 0;
+int Logger::nextLog = 0;
+std::uint32_t Logger::indexSequence = 0;
+
 Logger::Logger(logging_levels mLevel, std::string fileName, FILE * file) {
   // Store the minimum level, file name, and file
   Logger::minLevel = mLevel;
   Logger::fileName = fileName;
   Logger::logfile = file;
+  // Only the default numbered logger rotates
+  Logger::numbered = false;
+  Logger::size = 0;
 }
 
 void Logger::addNew(Logger * log) {
@@ -30,10 +39,18 @@ void Logger::_log(logging_levels level, std::string message) {
       return;
 
     // Write the formatted log with the file
-    fputs(("[" + util::timestamp() + "] " + Logger::getLoggingLevelName(level) + ": " + message + "\n").c_str(), logfile);
+    std::string line = "[" + util::timestamp() + "] " + Logger::getLoggingLevelName(level) + ": " + message + "\n";
+    fputs(line.c_str(), logfile);
 
     // Close the file to force the flush and write
     fclose(logfile);
+
+    // Move on to the next numbered log once this one is large enough
+    if (Logger::numbered) {
+      Logger::size += line.length();
+      if (Logger::size + RecordLog::getSize() >= LOGS_ROTATE_SIZE)
+        Logger::rotate();
+    }
   }
 
   if (minLevel == 0 || level > minLevel || logfile == NULL)
@@ -56,6 +73,17 @@ bool Logger::fileExists(std::string name) {
       return false;
 }
 
+long Logger::getFileSize(std::string name) {
+  // Seek to the end of the file to find its size
+  FILE * file = fopen(name.c_str(), "r");
+  if (file == NULL)
+    return 0;
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  fclose(file);
+  return size;
+}
+
 FILE * Logger::getFile() {
   // Return the log file
   return Logger::logfile;
@@ -68,15 +96,154 @@ void Logger::initializeDefaultLoggers() {
   // Initialize a logger to "/usd/latest.log"
   Logger::init("/usd/latest.log");
 
-  // If more than 500 existing logs exists, give a warning
-  if (fileExists(LOGS_PATH + std::string("500.log")))
-    Logger::log(LOG_ERROR, "Unable to open a numbered log file. SD card is holding existing logs.");
-  else {  // Initialize a logger to a numbered log file
-    int i = 0;
-  	while (fileExists(LOGS_PATH + util::ensureDigits(3, i) + ".log")) i++;
-  	Logger::init(LOGS_PATH + util::ensureDigits(3, i) + ".log");
+  // Initialize a logger to the next numbered log file, found from the index
+  Logger::loadIndex();
+  std::size_t count = Logger::loggers.size();
+  Logger::init(Logger::startNumberedLog());
+  if (Logger::loggers.size() > count)
+    Logger::loggers.back()->numbered = true;
+
+  // Record typed events alongside the numbered log
+  RecordLog::init(getRecordPath(Logger::logNumbers[Logger::logCount - 1]));
+}
+
+std::string Logger::getLogPath(int number) {
+  // Returns the path of the numbered log
+  return LOGS_PATH + util::ensureDigits(3, number) + ".log";
+}
+
+std::string Logger::getRecordPath(int number) {
+  // Returns the path of the record log
+  return LOGS_PATH + util::ensureDigits(3, number) + ".rec";
+}
+
+bool Logger::readIndex(std::string path, std::uint32_t & sequence) {
+  FILE * file = fopen(path.c_str(), "r");
+  if (file == NULL)
+    return false;
+
+  // Read the header, the number and size of each log, then the checksum of everything before it
+  unsigned long fileSequence, checksum;
+  int next, count;
+  int numbers[LOGS_MAX_COUNT];
+  long sizes[LOGS_MAX_COUNT];
+  bool complete = fscanf(file, "LOGS %lu %d %d", &fileSequence, &next, &count) == 3 && count >= 0 && count <= LOGS_MAX_COUNT;
+  std::uint32_t sum = fileSequence + next + count;
+  for (int i = 0; complete && i < count; i++) {
+    complete = fscanf(file, "%d %ld", &numbers[i], &sizes[i]) == 2;
+    sum += numbers[i] * 31 + sizes[i];
+  }
+  complete = complete && fscanf(file, " SUM %lu", &checksum) == 1 && checksum == sum;
+  fclose(file);
+
+  // Use this copy only if it is intact and newer
+  if (!complete || fileSequence <= sequence)
+    return false;
+  sequence = fileSequence;
+  Logger::nextLog = next;
+  Logger::logCount = count;
+  for (int i = 0; i < count; i++) {
+    Logger::logNumbers[i] = numbers[i];
+    Logger::logSizes[i] = sizes[i];
+  }
+  return true;
+}
+
+void Logger::loadIndex() {
+  // Use the newer intact copy of the index
+  Logger::indexSequence = 0;
+  Logger::readIndex(LOGS_INDEX_PATH_A, Logger::indexSequence);
+  Logger::readIndex(LOGS_INDEX_PATH_B, Logger::indexSequence);
+
+  if (Logger::indexSequence == 0) {
+    // There is no index yet, so search for the logs written before it once, as the logs were found before
+    Logger::logCount = 0;
+    Logger::nextLog = 0;
+    FILE * file;
+    while (Logger::nextLog < LOGS_NUMBER_LIMIT && (file = fopen(getLogPath(Logger::nextLog).c_str(), "r")) != NULL) {
+      if (Logger::logCount >= LOGS_MAX_COUNT) {
+        // Make room by removing the oldest log, as pruning would
+        remove(getLogPath(Logger::logNumbers[0]).c_str());
+        remove(getRecordPath(Logger::logNumbers[0]).c_str());
+        for (int i = 1; i < Logger::logCount; i++) {
+          Logger::logNumbers[i - 1] = Logger::logNumbers[i];
+          Logger::logSizes[i - 1] = Logger::logSizes[i];
+        }
+        Logger::logCount--;
+      }
+      fseek(file, 0, SEEK_END);
+      Logger::logNumbers[Logger::logCount] = Logger::nextLog;
+      Logger::logSizes[Logger::logCount] = ftell(file) + getFileSize(getRecordPath(Logger::nextLog));
+      Logger::logCount++;
+      fclose(file);
+      Logger::nextLog++;
+    }
+    Logger::nextLog %= LOGS_NUMBER_LIMIT;
+  }
+
+  // The newest log was still being written when its size was last recorded, so measure it and its record log
+  if (Logger::logCount > 0) {
+    int number = Logger::logNumbers[Logger::logCount - 1];
+    Logger::logSizes[Logger::logCount - 1] = getFileSize(getLogPath(number)) + getFileSize(getRecordPath(number));
+  }
+}
+
+void Logger::writeIndex() {
+  // Write over the older copy, so the newer one survives if this write is cut short
+  Logger::indexSequence++;
+  FILE * file = fopen(Logger::indexSequence % 2 == 1 ? LOGS_INDEX_PATH_A : LOGS_INDEX_PATH_B, "w");
+  if (file == NULL)
+    return;
+
+  std::uint32_t sum = Logger::indexSequence + Logger::nextLog + Logger::logCount;
+  fprintf(file, "LOGS %lu %d %d\n", (unsigned long) Logger::indexSequence, Logger::nextLog, Logger::logCount);
+  for (int i = 0; i < Logger::logCount; i++) {
+    fprintf(file, "%d %ld\n", Logger::logNumbers[i], Logger::logSizes[i]);
+    sum += Logger::logNumbers[i] * 31 + Logger::logSizes[i];
   }
+  fprintf(file, "SUM %lu\n", (unsigned long) sum);
+  fclose(file);
+}
+
+void Logger::pruneLogs() {
+  long total = 0;
+  for (int i = 0; i < Logger::logCount; i++)
+    total += Logger::logSizes[i];
+
+  // Remove the oldest log until within the limits, never removing the newest
+  while (Logger::logCount > 1 && (Logger::logCount > LOGS_MAX_COUNT || total > LOGS_MAX_SIZE)) {
+    remove(getLogPath(Logger::logNumbers[0]).c_str());
+    remove(getRecordPath(Logger::logNumbers[0]).c_str());
+    total -= Logger::logSizes[0];
+    for (int i = 1; i < Logger::logCount; i++) {
+      Logger::logNumbers[i - 1] = Logger::logNumbers[i];
+      Logger::logSizes[i - 1] = Logger::logSizes[i];
+    }
+    Logger::logCount--;
+  }
+}
+
+std::string Logger::startNumberedLog() {
+  // Take the next number, and record the new log in the index
+  int number = Logger::nextLog;
+  Logger::nextLog = (Logger::nextLog + 1) % LOGS_NUMBER_LIMIT;
+  Logger::logNumbers[Logger::logCount] = number;
+  Logger::logSizes[Logger::logCount] = 0;
+  Logger::logCount++;
+  Logger::pruneLogs();
+  Logger::writeIndex();
+  return getLogPath(number);
+}
+
+void Logger::rotate() {
+  // Finish the record log, and record the size of the finished log with it
+  RecordLog::flush();
+  Logger::logSizes[Logger::logCount - 1] = Logger::size + RecordLog::getSize();
 
+  // Continue both in new logs, so pruning never removes the record log being written
+  Logger::fileName = Logger::startNumberedLog();
+  Logger::size = 0;
+  RecordLog::init(getRecordPath(Logger::logNumbers[Logger::logCount - 1]));
 }
 
 void Logger::init(std::string fileName) {
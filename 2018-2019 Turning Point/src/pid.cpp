@@ -60,13 +60,7 @@ PIDCommand PID::calculate(PIDCalc * calc, int position, int target) {
   double power = util::limitX(PID::tLimit, p + i + d);
 
   // Account for max acceleration
-  if (util::abs(power) - util::abs(calc->lastPower) > PID::aLimit) {
-    if (power > 0.0)
-      power = calc->lastPower + PID::aLimit;
-    if (power < 0.0)
-      power = calc->lastPower - PID::aLimit;
-    calc->hangCycles = 0;
-  }
+  power = PID::limitAcceleration(calc, power);
 
   long rpower = std::lround(power);
   LCD::setText(3, "Power " + std::to_string(rpower));
@@ -85,8 +79,143 @@ PIDCommand PID::calculate(PIDCalc * calc, int position, int target) {
     return PIDCommand(E_COMMAND_CONTINUE, rpower);
 }
 
+double PID::limitAcceleration(PIDCalc * calc, double power) {
+  // Limit how much faster the power can be than the last power, not counting the time spent accelerating as hanging
+  if (util::abs(power) - util::abs(calc->lastPower) > PID::aLimit) {
+    if (power > 0.0)
+      power = calc->lastPower + PID::aLimit;
+    if (power < 0.0)
+      power = calc->lastPower - PID::aLimit;
+    calc->hangCycles = 0;
+  }
+  return power;
+}
+
 PIDCommand::PIDCommand(pid_command_type type, int result) {
   // Store the command type and result
   PIDCommand::type = type;
   PIDCommand::result = result;
 }
+
+PIDGroup::PIDGroup() {
+  // The group starts empty, using the default cross-coupling gain
+  PIDGroup::count = 0;
+  PIDGroup::kSync = PID_SYNC_KP;
+}
+
+void PIDGroup::clear() {
+  // Empty the group
+  PIDGroup::count = 0;
+}
+
+int PIDGroup::add(PID * pid, int target) {
+  // Add the channel to the end of the group, if there is room
+  if (PIDGroup::count >= MAX_CHANNELS)
+    return -1;
+  int channel = PIDGroup::count;
+  PIDGroup::pids[channel] = pid;
+  PIDGroup::calcs[channel] = PIDCalc();
+  PIDGroup::targets[channel] = target;
+  PIDGroup::powers[channel] = 0;
+  PIDGroup::times[channel] = 0;
+  // A channel without a target has nothing to do
+  PIDGroup::statuses[channel] = target == 0 ? E_COMMAND_EXIT_SUCCESS : E_COMMAND_CONTINUE;
+  PIDGroup::count++;
+  return channel;
+}
+
+int PIDGroup::size() {
+  // Returns the amount of channels
+  return PIDGroup::count;
+}
+
+void PIDGroup::setSync(double kSync) {
+  // Store the cross-coupling gain
+  PIDGroup::kSync = kSync;
+}
+
+void PIDGroup::calculate(const double positions[], int powers[], std::uint32_t time) {
+  // Calculate each channel whose dt has passed since its last calculation
+  bool due[MAX_CHANNELS];
+  double results[MAX_CHANNELS];
+  double lastPowers[MAX_CHANNELS];
+  for (int c = 0; c < PIDGroup::count; c++) {
+    due[c] = PIDGroup::times[c] == 0 || time - PIDGroup::times[c] >= (std::uint32_t) PIDGroup::pids[c]->dt;
+    if (!due[c])
+      continue;
+    PIDGroup::times[c] = time;
+    lastPowers[c] = PIDGroup::calcs[c].lastPower;
+    PIDCommand command = PIDGroup::pids[c]->calculate(&PIDGroup::calcs[c], positions[c], PIDGroup::targets[c]);
+    results[c] = command.result;
+
+    // Latch the first exit status of the channel
+    if (PIDGroup::statuses[c] == E_COMMAND_CONTINUE && (command.type == E_COMMAND_EXIT_SUCCESS || command.type == E_COMMAND_EXIT_FAILURE))
+      PIDGroup::statuses[c] = command.type;
+  }
+
+  // Find the average progress of the channels still moving, as a fraction of their targets
+  double progress = 0;
+  int moving = 0;
+  for (int c = 0; c < PIDGroup::count; c++)
+    if (PIDGroup::statuses[c] == E_COMMAND_CONTINUE) {
+      progress += positions[c] / PIDGroup::targets[c];
+      moving++;
+    }
+  if (moving > 0)
+    progress /= moving;
+
+  // Slow the channels calculated ahead of the group and speed up those behind, within each channel's power limit,
+  // then limit the acceleration of the coupled power so the coupling cannot jump past it. The others keep their last power
+  for (int c = 0; c < PIDGroup::count; c++) {
+    if (due[c]) {
+      double power = results[c];
+      if (moving > 1 && PIDGroup::statuses[c] == E_COMMAND_CONTINUE) {
+        double ahead = positions[c] - progress * PIDGroup::targets[c];
+        power = util::limitX(PIDGroup::pids[c]->tLimit, power - PIDGroup::kSync * ahead);
+      }
+      // The limit is from the last coupled power, rather than the power the channel calculated before coupling
+      PIDGroup::calcs[c].lastPower = lastPowers[c];
+      power = PIDGroup::pids[c]->limitAcceleration(&PIDGroup::calcs[c], power);
+      PIDGroup::calcs[c].lastPower = power;
+      PIDGroup::powers[c] = std::lround(power);
+    }
+    powers[c] = PIDGroup::powers[c];
+  }
+}
+
+bool PIDGroup::isComplete() {
+  // Returns whether no channel is still moving
+  for (int c = 0; c < PIDGroup::count; c++)
+    if (PIDGroup::statuses[c] == E_COMMAND_CONTINUE)
+      return false;
+  return true;
+}
+
+bool PIDGroup::isComplete(int channel) {
+  // Returns whether the channel has an exit status
+  return PIDGroup::statuses[channel] != E_COMMAND_CONTINUE;
+}
+
+pid_command_type PIDGroup::getStatus(int channel) {
+  // Returns the exit status of the channel
+  return PIDGroup::statuses[channel];
+}
+
+int PIDGroup::getError(int channel) {
+  // Returns the last error of the channel
+  return PIDGroup::calcs[channel].lastError;
+}
+
+PID * PIDGroup::getPID(int channel) {
+  // Returns the PID constants of the channel
+  return PIDGroup::pids[channel];
+}
+
+int PIDGroup::getInterval() {
+  // Find the smallest dt, so no channel waits longer than its own
+  int interval = 0;
+  for (int c = 0; c < PIDGroup::count; c++)
+    if (interval == 0 || PIDGroup::pids[c]->dt < interval)
+      interval = PIDGroup::pids[c]->dt;
+  return interval > 0 ? interval : 20;
+}
@@ -0,0 +1,110 @@
+#include "main.h"
+#include "recordlog.hpp"
+#include <cstring>
+
+/*
+ * The binary log format, all values little-endian
+ *
+ * Header: "RLOG", version, the amount of record types, the amount of fields in a record, 0
+ * Then for each record type, 16 byte names of the type, its port, and each of its fields
+ * Then blocks: "RLBK", a 32 bit record count, then the columns of the records:
+ *   32 bit times in ms, 8 bit types, 8 bit ports, then each field as 32 bit signed integers
+ */
+
+// The version of the format, increased whenever the layout or a schema changes
+static const std::uint8_t RECORD_LOG_VERSION = 1;
+
+// The length of each name in the schema
+static const int RECORD_NAME_LENGTH = 16;
+
+// The names of each record type, its port and its fields
+// Drive motors are recorded by their role, as they do not know their port, with the gyro heading as the role after them
+// Controllers are recorded as 0 for the main controller and 1 for the partner controller
+static const char * schema[E_RECORD_TYPE_COUNT][2 + RecordLog::RECORD_FIELDS] = {
+  {"movement", "pid", "frontLeft", "backLeft", "frontRight", "backRight"},
+  {"pid", "role", "status", "error", "duration", "target"},
+  {"motor", "role", "position", "velocity", "current", "temperature"},
+  {"controller", "controller", "connected", "", "", ""}
+};
+
+std::string RecordLog::path;
+std::uint32_t RecordLog::times[BLOCK_RECORDS];
+std::uint8_t RecordLog::types[BLOCK_RECORDS];
+std::uint8_t RecordLog::ports[BLOCK_RECORDS];
+std::int32_t RecordLog::fields[RECORD_FIELDS][BLOCK_RECORDS];
+int RecordLog::count = 0;
+long RecordLog::size = 0;
+
+void RecordLog::init(std::string path) {
+  FILE * file = fopen(path.c_str(), "wb");
+  if (file == NULL) {
+    Logger::log(LOG_ERROR, "Could not open the record log: " + path);
+    return;
+  }
+
+  // Write the header, then the names in the schema of each type padded to their length
+  std::uint8_t header[8] = {'R', 'L', 'O', 'G', RECORD_LOG_VERSION, E_RECORD_TYPE_COUNT, RECORD_FIELDS, 0};
+  fwrite(header, 1, sizeof(header), file);
+  for (int t = 0; t < E_RECORD_TYPE_COUNT; t++)
+    for (int n = 0; n < 2 + RECORD_FIELDS; n++) {
+      char name[RECORD_NAME_LENGTH] = {};
+      strncpy(name, schema[t][n], RECORD_NAME_LENGTH - 1);
+      fwrite(name, 1, RECORD_NAME_LENGTH, file);
+    }
+  fclose(file);
+
+  RecordLog::path = path;
+  RecordLog::count = 0;
+  RecordLog::size = sizeof(header) + E_RECORD_TYPE_COUNT * (2 + RECORD_FIELDS) * RECORD_NAME_LENGTH;
+}
+
+void RecordLog::record(record_type type, int port, int a, int b, int c, int d) {
+  // Ignore if not recording
+  if (RecordLog::path.empty())
+    return;
+
+  // Add the record to each column of the block
+  int i = RecordLog::count++;
+  RecordLog::times[i] = pros::millis();
+  RecordLog::types[i] = type;
+  RecordLog::ports[i] = port;
+  RecordLog::fields[0][i] = a;
+  RecordLog::fields[1][i] = b;
+  RecordLog::fields[2][i] = c;
+  RecordLog::fields[3][i] = d;
+
+  // Write the block once it is full
+  if (RecordLog::count >= BLOCK_RECORDS)
+    RecordLog::flush();
+}
+
+void RecordLog::flush() {
+  if (RecordLog::path.empty() || RecordLog::count == 0)
+    return;
+
+  // Append the block, closing the file to force the write as Logger does
+  FILE * file = fopen(RecordLog::path.c_str(), "ab");
+  if (file != NULL) {
+    std::uint32_t count = RecordLog::count;
+    fwrite("RLBK", 1, 4, file);
+    fwrite(&count, sizeof(count), 1, file);
+    fwrite(RecordLog::times, sizeof(RecordLog::times[0]), count, file);
+    fwrite(RecordLog::types, sizeof(RecordLog::types[0]), count, file);
+    fwrite(RecordLog::ports, sizeof(RecordLog::ports[0]), count, file);
+    for (int f = 0; f < RECORD_FIELDS; f++)
+      fwrite(RecordLog::fields[f], sizeof(RecordLog::fields[f][0]), count, file);
+    fclose(file);
+    RecordLog::size += 8 + count * (sizeof(RecordLog::times[0]) + sizeof(RecordLog::types[0]) + sizeof(RecordLog::ports[0]) + RECORD_FIELDS * sizeof(RecordLog::fields[0][0]));
+  }
+  RecordLog::count = 0;
+}
+
+long RecordLog::getSize() {
+  // Returns the bytes written
+  return RecordLog::size;
+}
+
+std::string RecordLog::getTypeName(record_type type) {
+  // Returns the name in the type's schema
+  return type >= 0 && type < E_RECORD_TYPE_COUNT ? schema[type][0] : "unknown";
+}
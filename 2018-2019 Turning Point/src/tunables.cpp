@@ -0,0 +1,203 @@
+#include "main.h"
+#include "tunables.hpp"
+#include <cmath>
+#include <cstring>
+
+// The static initializations of private Tunables fields. See the header file for documentation
+char Tunables::names[MAX_TUNABLES][NAME_LENGTH];
+double * Tunables::doubles[MAX_TUNABLES];
+int * Tunables::ints[MAX_TUNABLES];
+int Tunables::count = 0;
+double Tunables::staged[MAX_TUNABLES];
+std::uint32_t Tunables::changed[MAX_TUNABLES];
+std::atomic<std::uint32_t> Tunables::sequence(0);
+std::atomic<std::uint32_t> Tunables::applied(0);
+
+bool Tunables::add(const char * name, double * doubleValue, int * intValue) {
+  // Reuse the slot of a removed tunable, otherwise take the next slot
+  int i = 0;
+  while (i < Tunables::count && Tunables::names[i][0] != '\0')
+    i++;
+  if (i >= MAX_TUNABLES) {
+    Logger::log(LOG_WARNING, "The tunables registry is full, " + std::string(name) + " cannot be tuned");
+    return false;
+  }
+
+  // Start the staged value at the live value, with nothing to apply
+  strncpy(Tunables::names[i], name, NAME_LENGTH - 1);
+  Tunables::names[i][NAME_LENGTH - 1] = '\0';
+  Tunables::doubles[i] = doubleValue;
+  Tunables::ints[i] = intValue;
+  Tunables::staged[i] = doubleValue != NULL ? *doubleValue : *intValue;
+  Tunables::changed[i] = Tunables::applied.load(std::memory_order_relaxed);
+  if (i == Tunables::count)
+    Tunables::count++;
+  return true;
+}
+
+bool Tunables::add(const char * name, double * value) {
+  // Adds a decimal tunable
+  return Tunables::add(name, value, NULL);
+}
+
+bool Tunables::add(const char * name, int * value) {
+  // Adds an integer tunable
+  return Tunables::add(name, NULL, value);
+}
+
+void Tunables::addPID(const char * prefix, PID * pid) {
+  // Add each constant which can be changed between calculations, named as the prefix and the constant
+  char name[NAME_LENGTH];
+  snprintf(name, NAME_LENGTH, "%s.kp", prefix);
+  Tunables::add(name, &pid->kp);
+  snprintf(name, NAME_LENGTH, "%s.ki", prefix);
+  Tunables::add(name, &pid->ki);
+  snprintf(name, NAME_LENGTH, "%s.kd", prefix);
+  Tunables::add(name, &pid->kd);
+  snprintf(name, NAME_LENGTH, "%s.tLimit", prefix);
+  Tunables::add(name, &pid->tLimit);
+  snprintf(name, NAME_LENGTH, "%s.aLimit", prefix);
+  Tunables::add(name, &pid->aLimit);
+  snprintf(name, NAME_LENGTH, "%s.iLimit", prefix);
+  Tunables::add(name, &pid->iLimit);
+  snprintf(name, NAME_LENGTH, "%s.iZone", prefix);
+  Tunables::add(name, &pid->iZone);
+  snprintf(name, NAME_LENGTH, "%s.dThreshold", prefix);
+  Tunables::add(name, &pid->dThreshold);
+}
+
+void Tunables::remove(void * value) {
+  // Empty the slot of each tunable pointing to the value, so nothing is written through it once it is freed
+  for (int i = 0; i < Tunables::count; i++)
+    if (Tunables::doubles[i] == value || Tunables::ints[i] == value) {
+      Tunables::names[i][0] = '\0';
+      Tunables::doubles[i] = NULL;
+      Tunables::ints[i] = NULL;
+    }
+}
+
+void Tunables::removePID(PID * pid) {
+  // Removes each constant added by addPID()
+  Tunables::remove(&pid->kp);
+  Tunables::remove(&pid->ki);
+  Tunables::remove(&pid->kd);
+  Tunables::remove(&pid->tLimit);
+  Tunables::remove(&pid->aLimit);
+  Tunables::remove(&pid->iLimit);
+  Tunables::remove(&pid->iZone);
+  Tunables::remove(&pid->dThreshold);
+}
+
+int Tunables::size() {
+  // Returns the amount of slots, including those of removed tunables
+  return Tunables::count;
+}
+
+int Tunables::find(const char * name) {
+  // Search the registry in order, never matching a removed tunable
+  if (name[0] == '\0')
+    return -1;
+  for (int i = 0; i < Tunables::count; i++)
+    if (strcmp(Tunables::names[i], name) == 0)
+      return i;
+  return -1;
+}
+
+const char * Tunables::getName(int index) {
+  // Returns the name of the tunable, empty if it was removed
+  return Tunables::names[index];
+}
+
+double Tunables::get(int index) {
+  // Returns the staged value, only written by the staging task
+  return Tunables::staged[index];
+}
+
+bool Tunables::isPending() {
+  // Changes are pending when the staged sequence has moved past the last applied
+  return Tunables::sequence.load(std::memory_order_acquire) != Tunables::applied.load(std::memory_order_acquire);
+}
+
+void Tunables::begin() {
+  // Mark the staged values as being written
+  Tunables::sequence.store(Tunables::sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+}
+
+void Tunables::set(int index, double value) {
+  // Integer tunables are rounded as they are staged, so the staged value is what will be applied
+  if (index < 0 || index >= Tunables::count || Tunables::names[index][0] == '\0')
+    return;
+  Tunables::staged[index] = Tunables::ints[index] != NULL ? std::round(value) : value;
+  // Mark the tunable as changed by this sequence, so only it is written
+  Tunables::changed[index] = Tunables::sequence.load(std::memory_order_relaxed);
+}
+
+void Tunables::end() {
+  // Publish the staged values under the next even sequence number
+  Tunables::sequence.store(Tunables::sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+bool Tunables::apply() {
+  // Nothing to apply if the staged values are unchanged or being written
+  std::uint32_t before = Tunables::sequence.load(std::memory_order_acquire);
+  std::uint32_t last = Tunables::applied.load(std::memory_order_relaxed);
+  if (before == last || (before & 1))
+    return false;
+
+  // Copy the staged values and when they changed, then give up until the next call if a change started while copying
+  double values[MAX_TUNABLES];
+  std::uint32_t changed[MAX_TUNABLES];
+  memcpy(values, Tunables::staged, Tunables::count * sizeof(double));
+  memcpy(changed, Tunables::changed, Tunables::count * sizeof(std::uint32_t));
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (Tunables::sequence.load(std::memory_order_relaxed) != before)
+    return false;
+
+  // Write only the live values changed since the last apply, leaving values the program has since changed itself
+  for (int i = 0; i < Tunables::count; i++) {
+    // Skip those changed at or before the last apply, comparing so the sequence number may wrap
+    if (changed[i] - last - 1 >= before - last)
+      continue;
+    if (Tunables::doubles[i] != NULL)
+      *Tunables::doubles[i] = values[i];
+    else if (Tunables::ints[i] != NULL)
+      *Tunables::ints[i] = (int) values[i];
+  }
+  Tunables::applied.store(before, std::memory_order_release);
+  return true;
+}
+
+bool Tunables::save(std::string path) {
+  FILE * file = fopen(path.c_str(), "w");
+  if (file == NULL)
+    return false;
+
+  // Write each tunable as its name and value on a line
+  for (int i = 0; i < Tunables::count; i++)
+    if (Tunables::names[i][0] != '\0')
+      fprintf(file, "%s %.10g\n", Tunables::names[i], Tunables::staged[i]);
+  fclose(file);
+  return true;
+}
+
+bool Tunables::load(std::string path) {
+  FILE * file = fopen(path.c_str(), "r");
+  if (file == NULL)
+    return false;
+
+  // Stage the value of each line naming a tunable, logging those which differ from the staged value
+  char name[NAME_LENGTH];
+  double value;
+  Tunables::begin();
+  while (fscanf(file, "%31s %lf", name, &value) == 2) {
+    int index = Tunables::find(name);
+    if (index < 0 || Tunables::staged[index] == value)
+      continue;
+    Logger::log(LOG_INFO, "Tunable " + std::string(name) + " loaded as " + std::to_string(value) + ", was " + std::to_string(Tunables::staged[index]));
+    Tunables::set(index, value);
+  }
+  Tunables::end();
+  fclose(file);
+  return true;
+}
@@ -0,0 +1,188 @@
+/*
+ * Queries the binary record logs written by RecordLog, /usd/logs/NNN.rec on the microSD card
+ *
+ * Runs on a computer, not the robot. Build and run with:
+ *   g++ -O2 -std=c++17 -o logquery tools/logquery.cpp
+ *   ./logquery [--from <s>] [--to <s>] [--type <name>] [--port <n>] <file.rec>...
+ *   ./logquery --summary <file.rec>...
+ *
+ * Prints each matching record as a tab separated line of the file, time in seconds, type, then the port and
+ * fields named by the type's schema. Blocks of records outside the time range are skipped from their times
+ * alone, and fields are only read from blocks holding a match, so queries over many matches stay fast. The
+ * summary lists each file's records, time span and the count of each record type
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// The version of the format this reads, see src/recordlog.cpp
+static const int RECORD_LOG_VERSION = 1;
+static const int RECORD_NAME_LENGTH = 16;
+
+// The query, with the time range in ms and -1 for any type or port
+struct Query {
+  std::uint32_t from = 0;
+  std::uint32_t to = UINT32_MAX;
+  std::string type;
+  int port = -1;
+  bool summary = false;
+};
+
+// Reads exactly the given amount of bytes, returning whether there were enough
+static bool readBytes(FILE * file, void * data, std::size_t size) {
+  return std::fread(data, 1, size, file) == size;
+}
+
+// Queries or summarises one file, returning whether it could be read
+static bool queryFile(const std::string & path, const Query & query) {
+  FILE * file = std::fopen(path.c_str(), "rb");
+  if (file == NULL) {
+    std::cerr << "Could not read " << path << std::endl;
+    return false;
+  }
+
+  // Read the header and the schema of each record type
+  std::uint8_t header[8];
+  if (!readBytes(file, header, sizeof(header)) || std::memcmp(header, "RLOG", 4) != 0 || header[4] != RECORD_LOG_VERSION) {
+    std::cerr << path << " is not a version " << RECORD_LOG_VERSION << " record log" << std::endl;
+    std::fclose(file);
+    return false;
+  }
+  int typeCount = header[5];
+  int fieldCount = header[6];
+  std::vector<std::vector<std::string>> schema(typeCount);
+  for (int t = 0; t < typeCount; t++)
+    for (int n = 0; n < 2 + fieldCount; n++) {
+      char name[RECORD_NAME_LENGTH + 1] = {};
+      if (!readBytes(file, name, RECORD_NAME_LENGTH)) {
+        std::cerr << path << " has an incomplete schema" << std::endl;
+        std::fclose(file);
+        return false;
+      }
+      schema[t].push_back(name);
+    }
+
+  // The type the query is limited to, if any
+  int type = -1;
+  if (!query.type.empty()) {
+    for (int t = 0; t < typeCount; t++)
+      if (schema[t][0] == query.type)
+        type = t;
+    if (type < 0) {
+      std::fclose(file);
+      return true;
+    }
+  }
+
+  std::vector<std::uint32_t> times;
+  std::vector<std::uint8_t> types, ports;
+  std::vector<std::vector<std::int32_t>> fields(fieldCount);
+  std::vector<long> typeCounts(typeCount);
+  long records = 0, blocks = 0;
+  std::uint32_t first = 0, last = 0;
+
+  char magic[4];
+  std::uint32_t count;
+  while (readBytes(file, magic, 4) && std::memcmp(magic, "RLBK", 4) == 0 && readBytes(file, &count, sizeof(count))) {
+    // The bytes after the time column
+    long rest = (long) count * (2 + 4 * fieldCount);
+
+    // Read the times, and skip the block if none are in range
+    times.resize(count);
+    if (!readBytes(file, times.data(), count * sizeof(std::uint32_t)))
+      break;
+    if (count == 0 || (!query.summary && (times[count - 1] < query.from || times[0] > query.to))) {
+      std::fseek(file, rest, SEEK_CUR);
+      continue;
+    }
+
+    types.resize(count);
+    ports.resize(count);
+    if (!readBytes(file, types.data(), count) || !readBytes(file, ports.data(), count))
+      break;
+    rest -= 2 * count;
+
+    if (query.summary) {
+      // Count the records of each type
+      if (blocks == 0)
+        first = times[0];
+      last = times[count - 1];
+      blocks++;
+      records += count;
+      for (std::uint32_t i = 0; i < count; i++)
+        if (types[i] < typeCount)
+          typeCounts[types[i]]++;
+      std::fseek(file, rest, SEEK_CUR);
+      continue;
+    }
+
+    // Find the matching records, only reading the fields if there are any
+    std::vector<std::uint32_t> matches;
+    for (std::uint32_t i = 0; i < count; i++)
+      if (times[i] >= query.from && times[i] <= query.to && types[i] < typeCount && (type < 0 || types[i] == type) && (query.port < 0 || ports[i] == query.port))
+        matches.push_back(i);
+    if (matches.empty()) {
+      std::fseek(file, rest, SEEK_CUR);
+      continue;
+    }
+    bool complete = true;
+    for (int f = 0; f < fieldCount && complete; f++) {
+      fields[f].resize(count);
+      complete = readBytes(file, fields[f].data(), count * sizeof(std::int32_t));
+    }
+    if (!complete)
+      break;
+
+    for (std::uint32_t i : matches) {
+      const std::vector<std::string> & names = schema[types[i]];
+      std::printf("%s\t%.3f\t%s\t%s=%d", path.c_str(), times[i] / 1000.0, names[0].c_str(), names[1].c_str(), ports[i]);
+      for (int f = 0; f < fieldCount; f++)
+        if (!names[2 + f].empty())
+          std::printf("\t%s=%d", names[2 + f].c_str(), fields[f][i]);
+      std::printf("\n");
+    }
+  }
+  std::fclose(file);
+
+  if (query.summary) {
+    std::printf("%s: %ld records in %ld blocks, %.3f s to %.3f s\n", path.c_str(), records, blocks, first / 1000.0, last / 1000.0);
+    for (int t = 0; t < typeCount; t++)
+      std::printf("  %s: %ld\n", schema[t][0].c_str(), typeCounts[t]);
+  }
+  return true;
+}
+
+int main(int argc, char ** argv) {
+  Query query;
+  std::vector<std::string> paths;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool value = i + 1 < argc;
+    if (arg == "--from" && value)
+      query.from = std::atof(argv[++i]) * 1000;
+    else if (arg == "--to" && value)
+      query.to = std::atof(argv[++i]) * 1000;
+    else if (arg == "--type" && value)
+      query.type = argv[++i];
+    else if (arg == "--port" && value)
+      query.port = std::atoi(argv[++i]);
+    else if (arg == "--summary")
+      query.summary = true;
+    else
+      paths.push_back(arg);
+  }
+  if (paths.empty()) {
+    std::cerr << "Usage: " << argv[0] << " [--from <s>] [--to <s>] [--type <name>] [--port <n>] [--summary] <file.rec>..." << std::endl;
+    return 1;
+  }
+
+  bool success = true;
+  for (const std::string & path : paths)
+    success = queryFile(path, query) && success;
+  return success ? 0 : 1;
+}
@@ -0,0 +1,78 @@
+#ifndef _CACHEDMOTOR_HPP_
+#define _CACHEDMOTOR_HPP_
+
+#include "main.h"
+#include "sensorlog.hpp"
+
+/*
+ * Motor remembering the last command, brake mode and encoder units sent to it, and only sending changes
+ *
+ * The control loops issue the same commands to the mechanism motors every 20 ms, and the same brake mode to
+ * the drive every motion. Repeated writes are skipped, counted as saved, except that every REFRESH_SKIPS
+ * consecutive skips the write is sent again so a motor that was unplugged and reconnected gets its command
+ * back. Position moves are not cached, and make the next command be sent
+ */
+class CachedMotor : public LoggedMotor {
+private:
+  // Consecutive skipped writes after which the write is sent again
+  static const int REFRESH_SKIPS = 25;
+
+  // The kind of the last command sent
+  typedef enum cached_command_e {
+    E_CACHED_NONE,
+    E_CACHED_MOVE,
+    E_CACHED_VOLTAGE,
+    E_CACHED_VELOCITY
+  } cached_command;
+
+  // The last command, brake mode and encoder units sent, and how many writes of each have been skipped since
+  mutable cached_command command = E_CACHED_NONE;
+  mutable int target = 0;
+  mutable int commandSkips = 0;
+  mutable int brakeMode = -1;
+  mutable int brakeSkips = 0;
+  mutable int encoderUnits = -1;
+  mutable int encoderSkips = 0;
+  // The gearset, which the motor only changes when told to
+  mutable pros::motor_gearset_e_t gearset;
+
+  // Counts of writes sent and skipped by every cached motor
+  static std::uint32_t sent;
+  static std::uint32_t saved;
+
+  // Every cached motor constructed, one per port at most
+  static CachedMotor * motors[21];
+  static int count;
+
+  // Returns whether a write changing the cached value to the given value should be sent, updating the cache
+  static bool update(int & cached, int value, int & skips);
+  // Returns whether a command should be sent, updating the cache
+  bool updateCommand(cached_command kind, int value) const;
+
+public:
+  // Constructs the motor with the same parameters as pros::Motor
+  CachedMotor(std::uint8_t port, pros::motor_gearset_e_t gearset, bool reverse, pros::motor_encoder_units_e_t encoderUnits);
+
+  // Passthroughs which skip repeated writes
+  std::int32_t move(std::int32_t voltage) const override;
+  std::int32_t move_voltage(std::int32_t voltage) const override;
+  std::int32_t move_velocity(std::int32_t velocity) const override;
+  std::int32_t move_absolute(double position, std::int32_t velocity) const override;
+  std::int32_t move_relative(double position, std::int32_t velocity) const override;
+  std::int32_t set_brake_mode(pros::motor_brake_mode_e_t mode) const override;
+  std::int32_t set_encoder_units(pros::motor_encoder_units_e_t units) const override;
+  std::int32_t set_gearing(pros::motor_gearset_e_t gearset) const override;
+  // Returns the gearset without reading it from the motor
+  pros::motor_gearset_e_t get_gearing() const override;
+
+  // Forgets what was last sent, so the next write of each kind is sent
+  void invalidate() const;
+  // Invalidates every cached motor, called as each competition mode starts as the field may have stopped the motors
+  static void invalidateAll();
+
+  // Returns the amount of writes sent and skipped by every cached motor
+  static std::uint32_t getWritesSent();
+  static std::uint32_t getWritesSaved();
+};
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef _CHARACTERIZE_HPP_
+#define _CHARACTERIZE_HPP_
+
+#include "main.h"
+
+/*
+ * Drive characterization routines, used to find the static friction, velocity and acceleration
+ * feedforward constants of the drive
+ *
+ * Samples are held in memory while a test runs and written to the microSD card afterwards, to be
+ * fitted on a computer using tools/characterize.cpp
+ */
+namespace characterize {
+
+  // A single drive sample, with distances in inches and voltages in volts
+  struct Sample {
+    int test;
+    int time;
+    double voltage;
+    double battery;
+    double position;
+    double velocity;
+    double acceleration;
+  };
+
+  // The test identifiers written with each sample
+  const int QUASISTATIC_FORWARD = 0;
+  const int QUASISTATIC_BACKWARD = 1;
+  const int STEP_FORWARD = 2;
+  const int STEP_BACKWARD = 3;
+
+  // Runs the drive with a slowly increasing voltage, in volts per second, for the given duration in ms
+  void quasistatic(bool forward, double rampRate, int duration);
+
+  // Runs the drive with a constant voltage, in volts, for the given duration in ms
+  void stepVoltage(bool forward, double voltage, int duration);
+
+  // Clears all recorded samples
+  void clear();
+
+  // Writes all recorded samples to the given file as CSV, returning whether it was successful
+  bool save(std::string path);
+
+  // Runs all of the characterization tests, driving forward and back alternately, and saves the samples
+  void run();
+
+  /*
+   * Compares open-loop and cascaded control by moving forward and back the given amount of inches
+   * repeatedly with each, recording the time taken, the time to settle, the overshoot, the final distance error
+   * and the heading drift
+   *
+   * Results are written to /usd/benchmark.csv and summarized on the LCD
+   */
+  void benchmark(double inches, int repetitions);
+
+}
+
+#endif
@@ -42,6 +42,8 @@
 #define BRAKE_COAST pros::E_MOTOR_BRAKE_COAST
 #define BRAKE_BRAKE pros::E_MOTOR_BRAKE_BRAKE
 #define BRAKE_HOLD pros::E_MOTOR_BRAKE_HOLD
+#define MOTOR_MAX_VOLTAGE 12000 // in mV
+#define MOTOR_REFERENCE_VOLTAGE 11000 // in mV, the voltage given at full power regardless of battery charge
 
 // Notification enumeration definitions
 #define NOTIFY_BITS pros::E_NOTIFY_ACTION_BITS
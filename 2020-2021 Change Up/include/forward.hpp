@@ -7,12 +7,24 @@
  * Forward declaration for classes used in the project
  */
 
+class CachedMotor;
 class CompetitionTimer;
+class ControllerInput;
+class DriveRecorder;
+class DriverProfile;
 class Gyro;
+class InputCurve;
+class LoggedImu;
+class LoggedMotor;
 class MessageHolder;
 class PID;
+class SettleDetector;
+class TaskProfiler;
 
 // Whether to attach debugging modes to this compilation
 #define ATTACH_DEBUGGING true
 
+// Whether to time the sections of the control loops in this compilation
+#define ATTACH_TIMING true
+
 #endif
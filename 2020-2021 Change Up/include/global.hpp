@@ -56,6 +56,15 @@ namespace ports {
   // Gyro manager
   extern Gyro * gyro;
 
+  // Controller input manager
+  extern ControllerInput * input;
+
+  // Driver run recorder
+  extern DriveRecorder * recorder;
+
+  // Task profiler
+  extern TaskProfiler * profiler;
+
   // PID manager
   extern PID * pid;
 
@@ -65,7 +74,9 @@ namespace ports {
 
   // Tasks
   extern pros::Task * gyroTask;
+  extern pros::Task * inputTask;
   extern pros::Task * mhTask;
+  extern pros::Task * profilerTask;
 }
 
 // Selected autonomous routine
@@ -79,4 +90,13 @@ extern std::string postResult;
 // Driver skills auto running
 extern bool driverSkillsRunning;
 
+// Field-centric driving, and the heading treated as forward
+extern bool fieldCentric;
+extern double fieldCentricZero;
+
+// Driver input profiles and the selected profile
+extern DriverProfile * driverProfiles[];
+extern const int driverProfileCount;
+extern int selectedDriver;
+
 #endif
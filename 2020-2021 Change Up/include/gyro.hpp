@@ -2,6 +2,10 @@
 #define _GYRO_HPP_
 
 #include "main.h"
+#include <atomic>
+
+// Task to be given to the global Gyro object
+extern void gyroTask(void * param);
 
 /*
  * Better gyro implementation to account for averaging of multiple gyros and overflows
@@ -18,17 +22,24 @@ private:
   double headingZero = 0;
 
   // Variables to track how many full rotations to add to the final calculation
-  int rollLastRead;
-  int pitchLastRead;
-  int headingLastRead;
-  int rollRotations;
-  int pitchRotations;
-  int headingRotations;
+  int rollLastRead = 0;
+  int pitchLastRead = 0;
+  int headingLastRead = 0;
+  int rollRotations = 0;
+  int pitchRotations = 0;
+  int headingRotations = 0;
+
+  // The heading last read by the task, before subtracting the zero position. Atomic, as other tasks read it while
+  // the gyro task writes it, and a 64 bit double is not written in one access
+  std::atomic<double> headingCache{0};
 
   // Task to keep track of gyro overflowing
   void task();
 
 public:
+  // Reads the sensor once, tracking overflows; called by the task every 15 ms
+  void update();
+
   // Initilizes the gyros given global pointers
   Gyro(pros::Imu * imu);
 
@@ -36,6 +47,8 @@ public:
   double getRoll();
   double getPitch();
   double getHeading();
+  // Returns the heading last read by the task, without reading the sensor
+  double getCachedHeading();
 
   // Passthrough for acceleration
   pros::c::imu_accel_s_t getAcceleration(); // in g's (m/s^2)
@@ -47,7 +60,4 @@ public:
   void fullTarePosition();
 };
 
-// Task to be given to the global Gyro object
-extern void gyroTask(void * param);
-
 #endif
@@ -0,0 +1,155 @@
+#ifndef _INPUT_HPP_
+#define _INPUT_HPP_
+
+#include "main.h"
+#include <atomic>
+
+/*
+ * Response curve for a controller axis, with a deadband, expo and slew limit
+ *
+ * The deadband and expo are precomputed into a table when configured, so shaping a stick value
+ * costs one table lookup and the slew limit comparison
+ */
+class InputCurve {
+private:
+  // Shaped output for every stick value, indexed by the stick value plus 128
+  std::int8_t table[256];
+  // The maximum increase in output magnitude each call, 0 to disable
+  int slew = 0;
+  // The last shaped output, used for the slew limit
+  int last = 0;
+
+public:
+  // Constructs the InputCurve object with a linear response
+  InputCurve();
+
+  /*
+   * Precomputes the response table
+   *
+   * deadband: stick values with a magnitude at or below this give no output
+   * expo: blend between a linear (0) and cubic (1) response past the deadband
+   * slew: the maximum increase in output magnitude each call, 0 to disable
+   */
+  void configure(int deadband, double expo, int slew);
+
+  // Returns the shaped output, ranging from -127 to 127, for the given stick value
+  int shape(int value);
+};
+
+/*
+ * A driver's preferred response curves for each drive axis
+ */
+class DriverProfile {
+public:
+  // The name shown when the profile is selected
+  std::string name;
+
+  // Response curves for each drive axis
+  InputCurve move;
+  InputCurve turn;
+  InputCurve strafe;
+
+  // Constructs the DriverProfile object with linear responses
+  DriverProfile(std::string name);
+};
+
+/*
+ * An enumeration of controller button events
+ */
+typedef enum input_event_type_e {
+  E_INPUT_PRESS,
+  E_INPUT_RELEASE,
+  E_INPUT_HOLD
+} input_event_type;
+
+/*
+ * A debounced controller button event, timestamped when it was detected
+ */
+struct InputEvent {
+  pros::controller_id_e_t controller;
+  pros::controller_digital_e_t button;
+  input_event_type type;
+  std::uint32_t time; // in us
+};
+
+/*
+ * Class sampling both controllers in its own task, faster than the control loops run
+ *
+ * Button changes are debounced and queued as press, release and hold events, which the control loop
+ * consumes in order instead of polling for new presses. Stick values and button states are cached so
+ * reading them does not wait on the controller. Input keeps being sampled while a control loop is
+ * busy, such as while autonomous is run from operator control
+ */
+class ControllerInput {
+friend void inputTask(void * param);
+private:
+  // Sampling period and the amount of samples a button must be stable for to register
+  static const int SAMPLE_PERIOD = 5; // in ms
+  static const int DEBOUNCE_SAMPLES = 2;
+  // How long a button must be held before a hold event
+  static const int HOLD_TIME = 500; // in ms
+  // Capacity of the event queue
+  static const int QUEUE_SIZE = 32;
+
+  // The controllers to sample
+  pros::Controller * controllers[2];
+
+  // Cached stick values and debounced button states, indexed by controller then analog channel or button
+  volatile int analog[2][4] = {};
+  volatile bool digital[2][12] = {};
+  // Samples each button has differed from its debounced state, and the time it was last pressed
+  int unstable[2][12] = {};
+  std::uint32_t pressTime[2][12] = {};
+  bool held[2][12] = {};
+
+  // Single producer, single consumer event queue; the task only writes the head, consumers only the tail. Each side
+  // publishes its index with a release store and reads the other's with an acquire load, so an event is fully
+  // written before the consumer can see it, and fully read before the task can overwrite it
+  InputEvent queue[QUEUE_SIZE];
+  std::atomic<int> head{0};
+  std::atomic<int> tail{0};
+  // Events dropped because the queue was full
+  int dropped = 0;
+  // Samples taken so far, used to record and replay every other sample
+  int samples = 0;
+
+  // Latency between an event being detected and consumed
+  std::uint32_t latencyMax = 0;
+  std::uint32_t latencyTotal = 0;
+  std::uint32_t latencyCount = 0;
+
+  // Adds an event to the queue, dropping it if the queue is full
+  void push(int controller, int button, input_event_type type, std::uint32_t time);
+  // Updates the debounced state of a button, queueing events for any change or hold
+  void setButton(int controller, int button, bool pressed, std::uint32_t time);
+  // Replaces the main controller with the next frame of the recording being replayed
+  void replay(std::uint32_t time);
+
+  // Task sampling the controllers
+  void task();
+
+public:
+  // Constructs the ControllerInput object with the given controllers
+  ControllerInput(pros::Controller * controllerMain, pros::Controller * controllerPartner);
+
+  // Takes the next event from the queue, returning false if there are none
+  bool nextEvent(InputEvent & event);
+  // Discards all queued events
+  void clearEvents();
+
+  // Returns the last stick value read
+  int getAnalog(pros::controller_id_e_t controller, pros::controller_analog_e_t channel);
+  // Returns whether the button is held down, after debouncing
+  bool getDigital(pros::controller_id_e_t controller, pros::controller_digital_e_t button);
+
+  // Returns the maximum and average latency between events being detected and consumed, in us
+  std::uint32_t getMaxLatency();
+  std::uint32_t getAverageLatency();
+  // Returns the amount of events dropped because the queue was full
+  int getDroppedEvents();
+};
+
+// Task to be given to the global ControllerInput object
+extern void inputTask(void * param);
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef _KINEMATICS_HPP_
+#define _KINEMATICS_HPP_
+
+#include "main.h"
+
+/*
+ * Inverse kinematics for the X-drive, shared by operator control and autonomous
+ *
+ * Converts forward, strafe and turn commands into wheel powers, and scales wheel powers that cannot
+ * be reached down together so that the direction of travel is kept
+ */
+namespace kinematics {
+
+  // Powers for each wheel of the drive, ranging from -127 to 127 once desaturated
+  struct WheelPowers {
+    double frontLeft;
+    double backLeft;
+    double frontRight;
+    double backRight;
+  };
+
+  // Converts the forward, strafe (positive right) and turn (positive clockwise) commands into wheel powers
+  WheelPowers inverse(double forward, double strafe, double turn);
+
+  // Scales all wheel powers down by the same factor if any exceeds the maximum power
+  void desaturate(WheelPowers & powers, double maxPower = 127);
+
+}
+
+#endif
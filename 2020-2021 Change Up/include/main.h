@@ -77,12 +77,22 @@ void opcontrol(void);
  */
 //#include <iostream>
 #include "forward.hpp"
+#include "cachedmotor.hpp"
+#include "characterize.hpp"
 #include "debug.hpp"
 #include "definitions.hpp"
 #include "global.hpp"
 #include "gyro.hpp"
+#include "input.hpp"
+#include "kinematics.hpp"
 #include "lcd.hpp"
 #include "pid.hpp"
+#include "profiler.hpp"
+#include "recorder.hpp"
+#include "sensorlog.hpp"
+#include "settle.hpp"
+#include "timing.hpp"
+#include "trace.hpp"
 #include "util.hpp"
 #endif
 
@@ -2,6 +2,7 @@
 #define _PID_HPP_
 
 #include "main.h"
+#include "settle.hpp"
 
 class PID {
 friend class LCD;
@@ -18,6 +19,9 @@ friend class LCD;
   int maxPower = 80;
   int minPower = 20;
 
+  // Whether to send powers as velocity setpoints to the motors' internal velocity controllers
+  bool cascaded = false;
+
   // Positional PID values
   double movekp = 0;
   double moveki = 0;
@@ -57,26 +61,63 @@ friend class LCD;
   double accelerationPivotCoeff = 1;
   double accelerationPivotConst = 1;
   double accelerationPivotDelay = 50;
+  // Settle detectors for moving, strafing and pivoting
+  SettleDetector moveSettler;
+  SettleDetector strafeSettler;
+  SettleDetector pivotSettler;
+  // Whether the last motion ended by stalling or by running out of time
+  bool lastStalled = false;
+  bool lastTimedOut = false;
+  // How long the last motion took to settle, and how far it went past its target
+  int lastSettleTime = -1;
+  double lastOvershoot = 0;
+  // Function called at the end of every motion, if set
+  void (* motionCallback)(std::string name, double error) = NULL;
+
+  // Motion chaining request for the next motion
+  bool chainRequested = false;
+  double chainExitPower = 0;
+  double chainExitTolerance = 0;
+  double chainNextDirection = 1;
+  // Power and remaining distance, in degrees, handed off by the last motion
+  double chainPower = 0;
+  double chainDistance = 0;
+
+  // Drive feedforward constants, in volts, volts per in/s and volts per in/s^2
+  double feedforwardkS = 0;
+  double feedforwardkV = 0;
+  double feedforwardkA = 0;
+  // Acceleration to ramp up at when using feedforward, in in/s^2
+  double feedforwardAccel = 0;
+
   // Gyro to use during velocity PID
   Gyro * velocityGyro = NULL;
 
   double velocityGyroValue = 0;
 
-  // Calculates and returns the gear ratio for the drive
-  static double getGearRatio();
-
   // Sets the brake mode
   void setBrakeMode();
+  // Sends a power command to a drive motor, as a voltage compensated for the filtered battery voltage or as a velocity setpoint if using cascaded control
+  void commandMotor(pros::Motor * motor, double power, double battery);
   // Returns the power given the minimum and maximum power restraints
   double checkPower(double power);
 
   // The logic to continue PID loops
   bool continuePIDLoop(bool expr);
+  // Records how the motion tracked by the given settle detector ended, with its final error in inches or degrees
+  void finishMotion(SettleDetector & settler, std::string name, double error, bool timedOut);
+  // Takes the chaining request for the motion about to start, returning whether it is chained
+  bool takeChain();
+  // Ends the motion, handing off to the next motion at the exit power if chained, otherwise stopping the drive
+  void endMotion(bool chained, double direction, double remaining);
 
 public:
   // Constructs the PID object
   PID();
 
+  // Calculates and returns the gear ratio for the drive, in degrees per inch
+  static double getGearRatio();
+
   // Set the debugging flag to force PID loops to run non-stop; useful for tuning
   void setNoStopDebug(bool flag);
   // Set the debugging flag to force exit of PID loops when X is pressed; overrides noStop
@@ -86,6 +127,10 @@ public:
 
   // Sets the power limits of PID
   void setPowerLimits(int maxPower, int minPower);
+  // Sets whether to use cascaded control, where powers are sent as velocity setpoints, a fraction of the motors' maximum velocity
+  void setCascadedControl(bool flag);
+  // Returns whether cascaded control is being used
+  bool isCascadedControl();
   // Sets the move positional PID values
   void setMovePosPID(double movekp, double moveki, double movekd);
   // Sets the move velocity PID values
@@ -104,10 +149,51 @@ public:
   void setPivotAcceleration(double accelerationCoeff, double accelerationConst, double accelerationDelay);
   // Sets the gyro to be used during velocity PID
   void setVelocityGyro(Gyro * g);
+  // Sets the drive feedforward constants found with tools/characterize.cpp, and the acceleration to ramp up at
+  void setDriveFeedforward(double kS, double kV, double kA, double acceleration);
+  // Once a settle window is set, moves, strafes and pivots end by settling or stalling, with the error window widened
+  // to at least the threshold of the motion. Chained motions and velocity moves still end at their threshold
+  // Sets the move settle window, in degrees of wheel rotation
+  void setMoveSettle(double errorWindow, double velocityWindow, int dwellTime);
+  // Sets the move stall detection window, in degrees of wheel rotation
+  void setMoveStall(double stallVelocity, double stallPower, int stallTime);
+  // Sets the strafe settle window, in degrees of wheel rotation
+  void setStrafeSettle(double errorWindow, double velocityWindow, int dwellTime);
+  // Sets the strafe stall detection window, in degrees of wheel rotation
+  void setStrafeStall(double stallVelocity, double stallPower, int stallTime);
+  // Sets the pivot settle window, in degrees of heading
+  void setPivotSettle(double errorWindow, double velocityWindow, int dwellTime);
+  // Sets the pivot stall detection window, in degrees of heading
+  void setPivotStall(double stallVelocity, double stallPower, int stallTime);
+
+  // Returns whether the last motion ended by stalling rather than reaching its target
+  bool isStalled();
+  // Returns whether the last motion ran out of time before reaching its target
+  bool isTimedOut();
+  // Returns how long the last motion took to enter the settle window it settled in, in ms, or -1 if it did not settle
+  int getSettleTime();
+  // Returns how far the last motion went past its target, in degrees of wheel rotation for moves and strafes, and degrees of heading for pivots
+  double getOvershoot();
+  // Sets a function called at the end of every motion with its name and final error, in inches or degrees
+  void setMotionCallback(void (* callback)(std::string name, double error));
+
+  /*
+   * Chains the next move, velocity move or pivot into the motion following it
+   *
+   * Instead of stopping at its target, the next motion exits once it is within the exit tolerance
+   * (in inches for moves, degrees for pivots) and leaves the drive running at the exit power, in the
+   * direction of the move or, for a pivot, in nextDirection, the direction of the move following it.
+   * The following move continues from that power, and also covers the remaining distance if it is
+   * in the same direction. The drive keeps running until the following motion starts
+   */
+  void chain(double exitPower, double exitTolerance, int nextDirection = 1);
 
   // Resets the motor encoders
   void resetEncoders();
 
+  // Returns the power needed to hold the given velocity and acceleration, in in/s and in/s^2, using the feedforward constants
+  double feedforward(double velocity, double acceleration);
+
   // Sends the power commands to the motor
   void powerDrive(int powerLeft, int powerRight);
   // Ensures the robot drives straight
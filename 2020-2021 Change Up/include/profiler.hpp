@@ -0,0 +1,80 @@
+#ifndef _PROFILER_HPP_
+#define _PROFILER_HPP_
+
+#include "main.h"
+
+/*
+ * A single task's profile, as of the last sample
+ */
+struct TaskProfile {
+  // The task's name and priority
+  char name[16];
+  int priority;
+  // Share of the CPU over the last sample period, and the highest share seen, in percent
+  double cpu;
+  double maxCpu;
+  // Stack never used since the task started, in bytes
+  int stackFree;
+  // Whether the task is above the CPU limit or below the stack limit
+  bool overrun;
+};
+
+/*
+ * Class profiling every task on the brain, using the run time statistics and stack high water marks kept by
+ * the kernel
+ *
+ * Every sample period, the task reads the state of every task in one call, finds each task's share of the CPU
+ * since the last sample and its remaining stack, and flags any task above the CPU limit or within the stack
+ * limit of overflowing. The busiest task and the task with the least stack are shown on the LCD, and each
+ * task's profile is written to the message holder if reporting is enabled
+ */
+class TaskProfiler {
+friend void profilerTask(void * param);
+private:
+  // Sample period, and the most tasks that can be profiled
+  static const int SAMPLE_PERIOD = 1000; // in ms
+  static const int MAX_TASKS = 24;
+
+  // Profiles as of the last sample, and the run time counters they were found from
+  TaskProfile profiles[MAX_TASKS];
+  void * handles[MAX_TASKS] = {};
+  std::uint32_t lastRunTime[MAX_TASKS] = {};
+  std::uint32_t lastTotalRunTime = 0;
+  volatile int count = 0;
+
+  // Limits above which a task is flagged
+  double cpuLimit = 80; // in percent
+  int stackLimit = 512; // in bytes
+
+  // Whether to write each task's profile to the message holder
+  bool reporting = false;
+  // Whether there have been more tasks than can be profiled
+  bool tooMany = false;
+
+  // Task sampling every task
+  void task();
+
+public:
+  // Constructs the TaskProfiler object
+  TaskProfiler();
+
+  // Samples every task, updating the profiles
+  void sample();
+
+  // Sets the limits a task is flagged at, its share of the CPU in percent and its remaining stack in bytes
+  void setLimits(double cpuLimit, int stackLimit);
+  // Sets whether to write each task's profile to the message holder every sample
+  void setReporting(bool flag);
+
+  // Returns the amount of tasks profiled
+  int getTaskCount();
+  // Returns the profile of the task at the given index
+  TaskProfile getProfile(int index);
+  // Returns whether any task was flagged in the last sample
+  bool isOverrun();
+};
+
+// Task to be given to the global TaskProfiler object
+extern void profilerTask(void * param);
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef _RECORDER_HPP_
+#define _RECORDER_HPP_
+
+#include "main.h"
+
+/*
+ * Class recording the main controller's input during a driver run so it can be replayed as an autonomous
+ *
+ * The input task records a frame every 10 ms while recording. Each frame is delta encoded: a header byte
+ * flags which sticks and buttons changed since the last frame, followed by only the changed values, so a
+ * frame where nothing changed takes one byte. Every tenth frame is a keyframe that also holds the heading
+ * and drive position, which replay steers back towards to correct for drift
+ *
+ * While replaying, the input task feeds the recorded frames in place of the main controller, so the
+ * recording drives the robot through the same operator control code that recorded it. The operator control
+ * state the recorded buttons toggle, field-centric driving and the driver profile, is saved when recording
+ * starts and restored when replay starts, so the replayed presses toggle it the same way
+ */
+class DriveRecorder {
+private:
+  // Frame period and keyframe interval
+  static const int FRAME_PERIOD = 10; // in ms
+  static const int KEYFRAME_INTERVAL = 10; // in frames
+  // Capacity of the recording, enough for a one minute run where every frame changes
+  static const int BUFFER_SIZE = 48000; // in bytes
+
+  // Correction gains towards the recorded heading and position, and the largest correction applied
+  static constexpr double HEADING_KP = 2.0; // power per degree
+  static constexpr double POSITION_KP = 0.15; // power per degree of wheel rotation
+  static constexpr double MAX_CORRECTION = 30;
+
+  // The encoded recording
+  std::uint8_t buffer[BUFFER_SIZE];
+  int length = 0;
+  // Read position while replaying
+  int cursor = 0;
+  // Frames recorded or replayed so far
+  int frames = 0;
+
+  volatile bool recording = false;
+  volatile bool replaying = false;
+
+  // The last values recorded or replayed, which the next frame is encoded against
+  int lastAnalog[4] = {};
+  int lastButtons = 0;
+
+  // Heading and drive position at the start of recording or replay, and the last keyframe replayed
+  double startHeading = 0;
+  double startPosition = 0;
+  double targetHeading = 0;
+  double targetPosition = 0;
+  // Operator control state when recording started, with the field-centric forward heading relative to the start heading
+  bool startFieldCentric = false;
+  double startFieldCentricZero = 0;
+  int startDriver = 0;
+  // Corrections calculated at the last keyframe replayed
+  double moveCorrection = 0;
+  double turnCorrection = 0;
+
+  // Returns the average position of the drive motors, in degrees
+  double drivePosition();
+
+  // Appends a value of the given amount of bytes, returning false if the buffer is full
+  bool write(std::int32_t value, int bytes);
+  // Reads a value of the given amount of bytes
+  std::int32_t read(int bytes);
+
+public:
+  // Constructs the DriveRecorder object
+  DriveRecorder();
+
+  // Starts a new recording, saving the operator control state
+  void startRecording();
+  // Stops the recording
+  void stopRecording();
+  // Returns whether a recording is in progress
+  bool isRecording();
+
+  // Starts replaying the recording from the beginning, restoring the operator control state it started with
+  void startReplay();
+  // Stops replaying the recording
+  void stopReplay();
+  // Returns whether a recording is being replayed
+  bool isReplaying();
+
+  // Records a frame of stick values and button states, a bitmask indexed from BUTTON_L1
+  void record(const volatile int analog[4], int buttons);
+  // Reads the next frame of stick values and button states, returning false once the recording has ended
+  bool playback(int analog[4], int & buttons);
+
+  // Returns the power to add to forward movement and turning to steer back towards the recording
+  double getMoveCorrection();
+  double getTurnCorrection();
+  // Returns the heading the robot had at the last keyframe replayed, which the move correction is along
+  double getCorrectionHeading();
+
+  // Writes the recording to the given file, returning whether it was successful
+  bool save(std::string path);
+  // Reads a recording from the given file, returning whether it was successful
+  bool load(std::string path);
+};
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef _SENSORLOG_HPP_
+#define _SENSORLOG_HPP_
+
+#include "main.h"
+
+/*
+ * Log of every device read and write made by the control code during autonomous, so a real run can be
+ * replayed through the same code on a computer using tools/replay.cpp
+ *
+ * The drive and mechanism motors and the inertial sensor are created as LoggedMotor and LoggedImu objects,
+ * which record each call as it passes through to the device. The clock and battery readings used by the
+ * control loops go through sensorlog::millis() and sensorlog::battery() for the same reason. Each record is
+ * tagged with the task that made it, so the gyro task can be replayed in step with the autonomous task
+ *
+ * When nothing is being logged, recording costs a single flag check
+ */
+namespace sensorlog {
+
+  // The value recorded by a record
+  typedef enum sensor_channel_e {
+    E_SENSOR_MILLIS = 0,
+    E_SENSOR_BATTERY,
+    E_SENSOR_POSITION,
+    E_SENSOR_YAW,
+    E_SENSOR_PITCH,
+    E_SENSOR_ROLL,
+    E_SENSOR_MOVE,
+    E_SENSOR_MOVE_VOLTAGE,
+    E_SENSOR_MOVE_VELOCITY,
+    E_SENSOR_TARE
+  } sensor_channel;
+
+  // The task a record was made from
+  const int TASK_LOGGED = 0;
+  const int TASK_GYRO = 1;
+  const int TASK_OTHER = 2;
+
+  // A single read or write, with the time in microseconds and the device's port, or 0 for the brain
+  struct Record {
+    std::uint32_t time;
+    std::uint8_t task;
+    std::uint8_t port;
+    std::uint8_t channel;
+    std::uint8_t reserved;
+    double value;
+  };
+
+  // The maximum amount of records held in memory, about a minute of autonomous
+  const int MAX_RECORDS = 65536;
+
+  // Starts a new log from the calling task, storing the autonomous being run
+  void start(int autonomous);
+  // Stops logging
+  void stop();
+  // Returns whether a log is in progress
+  bool isLogging();
+  // Writes the log to the given file, returning whether it was successful
+  bool save(std::string path);
+
+  // Records a value read from or written to a device, returning the value
+  double record(int port, sensor_channel channel, double value);
+
+  // Returns the time since the program started, in ms, recording it if logging
+  std::uint32_t millis();
+  // Returns the battery voltage, in mV, recording it if logging
+  std::int32_t battery();
+
+}
+
+/*
+ * Motor recording the reads and writes made by the control code to the sensor log
+ */
+class LoggedMotor : public pros::Motor {
+public:
+  // Constructs the motor with the same parameters as pros::Motor
+  LoggedMotor(std::uint8_t port, pros::motor_gearset_e_t gearset, bool reverse, pros::motor_encoder_units_e_t encoderUnits);
+
+  // Passthroughs which record to the sensor log
+  std::int32_t move(std::int32_t voltage) const override;
+  std::int32_t move_voltage(std::int32_t voltage) const override;
+  std::int32_t move_velocity(std::int32_t velocity) const override;
+  std::int32_t tare_position() const override;
+  double get_position() const override;
+};
+
+/*
+ * Inertial sensor recording the reads made by the control code to the sensor log
+ */
+class LoggedImu : public pros::Imu {
+private:
+  // The port of the sensor, which pros::Imu does not expose
+  std::uint8_t port;
+
+public:
+  // Constructs the sensor on the given port
+  LoggedImu(std::uint8_t port);
+
+  // Passthroughs which record to the sensor log
+  double get_yaw() const override;
+  double get_pitch() const override;
+  double get_roll() const override;
+};
+
+#endif
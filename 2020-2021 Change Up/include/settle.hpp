@@ -0,0 +1,76 @@
+#ifndef _SETTLE_HPP_
+#define _SETTLE_HPP_
+
+#include "main.h"
+
+/*
+ * Class to determine when a PID motion has settled at its target or stalled against an obstacle
+ *
+ * Modelled after okapi's SettledUtil: a motion is settled once its error and the rate of change of
+ * its error have both stayed within their windows for the dwell time. A motion is stalled once it has
+ * been commanding at least the stall power while moving slower than the stall velocity for the stall time
+ *
+ * The error window of a motion is never tighter than its exit threshold, so a motion which stops just outside
+ * its threshold still settles instead of running until it times out
+ */
+class SettleDetector {
+private:
+  // Settle window, in error units, error units per second and ms. A window of 0 disables settling
+  double errorWindow = 0;
+  double velocityWindow = 0;
+  int dwellTime = 0;
+  // The error window of the current motion, the settle window widened to the motion's exit threshold
+  double motionErrorWindow = 0;
+
+  // Stall window, in error units per second, motor power and ms. A time of 0 disables stall detection
+  double stallVelocity = 0;
+  double stallPower = 0;
+  int stallTime = 0;
+
+  // State of the current motion
+  bool started = false;
+  bool settled = false;
+  bool stalled = false;
+  double lastError = 0;
+  double velocity = 0;
+  int lastUpdate = 0;
+  int settleStart = 0;
+  int stallStart = 0;
+  // The time and error of the first update, how long the motion took to enter the window it settled in, and
+  // the furthest it went past its target
+  int startTime = 0;
+  double startError = 0;
+  int settleTime = -1;
+  double overshoot = 0;
+
+public:
+  // Constructs the SettleDetector object, with settling and stall detection disabled
+  SettleDetector();
+
+  // Sets the settle window
+  void setSettleWindow(double errorWindow, double velocityWindow, int dwellTime);
+  // Sets the stall detection window
+  void setStallWindow(double stallVelocity, double stallPower, int stallTime);
+
+  // Resets the state in preparation for a new motion exiting within the given threshold, in error units
+  void reset(double threshold = 0);
+
+  // Returns whether settling is enabled, in which case the motion should end by settling rather than at its threshold
+  bool settles();
+
+  // Updates the detector with the latest error and the power being commanded, returning whether the motion is done
+  bool update(double error, double power);
+
+  // Returns whether the last motion settled at its target
+  bool isSettled();
+  // Returns whether the last motion stalled before reaching its target
+  bool isStalled();
+  // Returns the last calculated rate of change of error, in error units per second
+  double getVelocity();
+  // Returns how long the last motion took to enter the settle window it settled in, in ms, or -1 if it did not settle
+  int getSettleTime();
+  // Returns how far the last motion went past its target, in error units
+  double getOvershoot();
+};
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef _TIMING_HPP_
+#define _TIMING_HPP_
+
+#include "main.h"
+#include "util.hpp"
+
+/*
+ * Timing of named sections of the control loops, to find where each 20 ms tick goes
+ *
+ * Each section keeps its count, total, minimum, maximum and a histogram of its times in a fixed table, so
+ * recording a time allocates nothing and takes a few instructions. The histogram has four buckets for every
+ * power of two, giving the 99th percentile to within a quarter of its value. A section should only be timed
+ * from one task, as the table is not locked
+ *
+ * Time a whole function or block with TIME_SCOPE(section), or part of a block with TIME_START(section) and
+ * TIME_STOP(section). All three compile to nothing if ATTACH_TIMING is false
+ */
+namespace timing {
+
+  // The sections timed
+  typedef enum timing_section_e {
+    E_TIMING_SENSOR_READ,
+    E_TIMING_PID_COMPUTE,
+    E_TIMING_MOTOR_WRITE,
+    E_TIMING_LCD_UPDATE,
+    E_TIMING_GYRO_UPDATE,
+    E_TIMING_SECTION_COUNT
+  } timing_section;
+
+  // The times recorded for a section, in microseconds
+  struct Summary {
+    std::uint32_t count;
+    std::uint32_t min;
+    double mean;
+    std::uint32_t max;
+    std::uint32_t p99;
+  };
+
+  // Records a time for the section, in microseconds
+  void record(timing_section section, std::uint32_t time);
+
+  // Returns the times recorded for the section
+  Summary getSummary(timing_section section);
+  // Returns the name of the section
+  std::string getName(timing_section section);
+
+  // Writes the times of every section to the message holder
+  void report();
+  // Clears the times of every section
+  void reset();
+
+  /*
+   * Records the time from its construction to the end of its scope
+   */
+  class Scope {
+  private:
+    timing_section section;
+    std::uint32_t start;
+  public:
+    // Starts timing the section
+    Scope(timing_section section) : section(section), start(util::micros()) {}
+    // Records the time taken
+    ~Scope() {
+      record(section, util::micros() - start);
+    }
+  };
+
+}
+
+#if ATTACH_TIMING
+#define TIMING_CONCAT_(a, b) a##b
+#define TIMING_CONCAT(a, b) TIMING_CONCAT_(a, b)
+#define TIME_SCOPE(section) timing::Scope TIMING_CONCAT(timingScope, __LINE__)(timing::section)
+#define TIME_START(section) std::uint32_t timingStart_##section = util::micros()
+#define TIME_STOP(section) timing::record(timing::section, util::micros() - timingStart_##section)
+#else
+// Compile the timing out if it is not attached
+#define TIME_SCOPE(section)
+#define TIME_START(section)
+#define TIME_STOP(section)
+#endif
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef _TRACE_HPP_
+#define _TRACE_HPP_
+
+#include "main.h"
+
+/*
+ * Timeline of what each task was doing during autonomous, for viewing with Chrome's trace viewer after
+ * converting with tools/trace.cpp
+ *
+ * Motions, autonomous routines and task loop iterations record begin and end events, mechanism commands and
+ * autonomous steps record instant events, and the timed sections of the control loops record complete
+ * events, all with microsecond timestamps into a fixed buffer. Each event is tagged with the task that made
+ * it, so the scheduling of the autonomous, gyro and input tasks can be lined up
+ *
+ * Event names must be string literals, as only the pointer is stored. When nothing is being traced,
+ * recording an event costs a single flag check
+ */
+namespace trace {
+
+  // The kind of an event, using the phase letters of the trace event format
+  const char PHASE_BEGIN = 'B';
+  const char PHASE_END = 'E';
+  const char PHASE_INSTANT = 'i';
+  const char PHASE_COMPLETE = 'X';
+
+  // A single event, with its time and the duration of a complete event in microseconds
+  struct Event {
+    std::uint32_t time;
+    std::uint32_t duration;
+    const char * name;
+    char phase;
+    std::uint8_t task;
+  };
+
+  // The maximum amount of events held in memory, and of tasks events are tagged against. A minute long skills run
+  // records around 10000 events from the motion loops, so events must not be recorded from fast loops such as the
+  // 5 ms controller sampling, which alone would fill the trace in under a minute
+  const int MAX_EVENTS = 32768;
+  const int MAX_TASKS = 16;
+
+  // Starts a new trace
+  void start();
+  // Stops tracing
+  void stop();
+  // Returns whether a trace is in progress
+  bool isTracing();
+
+  // Writes the trace to the given file, returning whether it was successful
+  bool save(std::string path);
+  // Writes the trace to the serial output
+  void print();
+
+  // Records the start of something the calling task is doing
+  void begin(const char * name);
+  // Records the end of something the calling task was doing
+  void end(const char * name);
+  // Records something happening at an instant
+  void instant(const char * name);
+  // Records something the calling task has just finished, which took the given duration in microseconds
+  void complete(const char * name, std::uint32_t duration);
+
+  /*
+   * Records a begin event on construction and an end event at the end of its scope
+   */
+  class Scope {
+  private:
+    const char * name;
+  public:
+    // Records the beginning
+    Scope(const char * name) : name(name) {
+      begin(name);
+    }
+    // Records the end
+    ~Scope() {
+      end(name);
+    }
+  };
+
+}
+
+#endif
@@ -25,6 +25,23 @@ namespace util {
   // Converts an unsigned integer to a signed integer
   signed int sign(unsigned int a);
 
+  // Returns the time since the program started, in microseconds, wrapping after about 71 minutes
+  std::uint32_t micros();
+
+  // Samples the battery voltage, in mV, filtered so that momentary sag under load does not cause jumps in output
+  // Call once per control cycle, only from the task commanding the motors, and pass the result to powerToVoltage
+  double sampleBattery();
+
+  // Returns the filtered battery voltage of the last sample, in mV
+  double getBattery();
+
+  // Converts a motor power, ranging from -127 to 127, to a voltage in mV, compensating for the filtered battery voltage
+  // A power of 127 gives the reference voltage at any battery charge, where possible
+  int powerToVoltage(double power, double battery);
+
+  // Converts a voltage in mV to the motor power powerToVoltage() converts back to it, at the filtered battery voltage
+  double voltageToPower(double voltage, double battery);
+
 }
 
 #endif
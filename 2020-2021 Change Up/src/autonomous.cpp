@@ -17,20 +17,26 @@ using namespace ports;
 
 // Powers the intake at a given power
 void powerIntake(int power) {
-  intakeMotorRight->move(power);
-  intakeMotorLeft->move(power);
+  trace::instant("Intake");
+  // Sample the battery, as the mechanisms may be commanded before the drive has sampled it. Autonomous runs in the task commanding the drive
+  double battery = util::sampleBattery();
+  intakeMotorRight->move_voltage(util::powerToVoltage(power, battery));
+  intakeMotorLeft->move_voltage(util::powerToVoltage(power, battery));
 }
 
 void cycle(int power) {
-  flywheel->move(power);
+  trace::instant("Cycle");
+  double battery = util::sampleBattery();
+  flywheel->move_voltage(util::powerToVoltage(power, battery));
   powerIntake(power);
-  indexer->move(power);
+  indexer->move_voltage(util::powerToVoltage(power, battery));
 }
 
 void flipout() {
-  indexer->move(45);
+  trace::Scope stepTrace("Flipout");
+  indexer->move_voltage(util::powerToVoltage(45, util::sampleBattery()));
   pros::delay(425);
-  indexer->move(0);
+  indexer->move_voltage(util::powerToVoltage(0, util::sampleBattery()));
 }
 
 void waitForUltrasonic(double maxtime, double threshold = 150, bool n = false) { // threshold in cm
@@ -95,12 +101,15 @@ void autonnomousSkills() {
   pros::delay(300);
   flywheel->move(0);
   // First tower done
+  trace::instant("First tower done");
 
   // Back up and align with the next ball
   cycle(-90);
   indexer->move(-127);
   pid->move(-30.6);
   cycle(0);
+  // Hand the pivot off into the forward move without stopping
+  pid->chain(40, 3, 1);
   pid->pivotAbsolute(26.7);
   
   // Intake and score the next ball
@@ -115,6 +124,7 @@ void autonnomousSkills() {
   pros::delay(1100);
   pid->powerDrive(0,0);
   // Second tower done
+  trace::instant("Second tower done");
 
   // Back up and align with the next ball
   cycle(0);
@@ -153,6 +163,7 @@ void autonnomousSkills() {
   pros::delay(250);
   cycle(0);
   // Third tower done
+  trace::instant("Third tower done");
 
   // Back up and align with the next ball
   cycle(-100);
@@ -181,6 +192,7 @@ void autonnomousSkills() {
   flywheel->move(0);
   pid->powerDrive(0,0);
   // Fourth tower done
+  trace::instant("Fourth tower done");
 
   // Back up and align with the next ball
   cycle(-90);
@@ -207,12 +219,15 @@ void autonnomousSkills() {
   flywheel->move(0);
   pid->powerDrive(0,0);
   // Fifth tower done
+  trace::instant("Fifth tower done");
 
  // Back up and align with the next ball
   cycle(-90);
   indexer->move(-127);
   pid->move(-39.75);
   cycle(0);
+  // Hand the pivot off into the forward move without stopping
+  pid->chain(40, 3, 1);
   pid->pivot(-57.5);
   
   // Intake and score the next ball
@@ -228,6 +243,7 @@ void autonnomousSkills() {
   pros::delay(500);
   cycle(0);
   // Sixth tower done
+  trace::instant("Sixth tower done");
 
   // Reset routine
   flywheel->move(-127);
@@ -263,6 +279,7 @@ void autonnomousSkills() {
   cycle(127);
   pros::delay(1400);
   // Seventh tower done
+  trace::instant("Seventh tower done");
 
   // Center tower
   cycle(-70);
@@ -308,7 +325,8 @@ void autonomousDrvSkills() {
   while (controllerMain->get_analog(STICK_LEFT_X) == 0 && controllerMain->get_analog(STICK_LEFT_Y) == 0 && controllerMain->get_analog(STICK_RIGHT_X) == 0 && controllerMain->get_analog(STICK_RIGHT_Y) == 0 && !(controllerMain->get_digital(BUTTON_L1) || controllerMain->get_digital(BUTTON_L2) || controllerMain->get_digital(BUTTON_R1) || controllerMain->get_digital(BUTTON_R2)))
     pros::delay(1);
 
-  // Allow movement and start timing
+  // Allow movement and start timing, recording the run so it can be replayed
+  recorder->startRecording();
   pros::Task dsopcontrol (Temp::call, NULL, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, "Driver Skills");
 
   // Use vibrations to tell how much time is left
@@ -331,6 +349,7 @@ void autonomousDrvSkills() {
   competitionTimer->opcontrolWaitUntil(60000);
   controllerMain->rumble(".");
   dsopcontrol.suspend();
+  recorder->stopRecording();
 
   // Stop all motors
   if (ports::port1 != NULL) ports::port1->move(0);
@@ -355,10 +374,41 @@ void autonomousDrvSkills() {
   if (ports::port20 != NULL) ports::port20->move(0);
   if (ports::port21 != NULL) ports::port21->move(0);
 
+  // Save the recorded run
+  if (recorder->save("/usd/drvskills.rec"))
+    LCD::setText(7, "Driver run saved");
+
   // Wait for 5 seconds before giving control back
   pros::delay(5000);
 }
 
+// Replays the last recorded driver skills run through operator control
+void autonomousReplay() {
+  struct Temp {
+    static void call(void * param) {
+      opcontrol();
+    }
+  };
+
+  // Load the recording from the microSD card
+  if (!recorder->load("/usd/drvskills.rec")) {
+    LCD::setText(7, "No driver run to replay");
+    return;
+  }
+
+  // Replay the run through operator control until the recording ends
+  recorder->startReplay();
+  pros::Task replayopcontrol (Temp::call, NULL, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, "Replay");
+  while (recorder->isReplaying())
+    pros::delay(20);
+
+  // Give the operator control loop time to see the released controls, then stop
+  pros::delay(100);
+  replayopcontrol.suspend();
+  pid->powerDrive(0, 0);
+  cycle(0);
+}
+
 void autonomousOther(int selectedAutonomous) {
   // Release the hood
   flipout();
@@ -369,10 +419,18 @@ void autonomousOther(int selectedAutonomous) {
 void autonomous() {
   // Sets the status on the LCD
 	LCD::setStatus("Autonomous " + LCD::getAutonomousName());
+	// The motors were stopped while disabled, so send every command afresh
+	CachedMotor::invalidateAll();
 
 	// Start the autonomous timer
 	competitionTimer->autonomousStartTimer();
 
+  // Log the device reads and writes so the run can be replayed, and time and trace this run's control loops
+  sensorlog::start(selectedAutonomous);
+  timing::reset();
+  trace::start();
+  trace::begin("Autonomous");
+
   // Based on the selected autonomous, run
   if (selectedAutonomous == 1)
     autonomousBlueRight();
@@ -386,13 +444,27 @@ void autonomous() {
     autonnomousSkills();
   else if (selectedAutonomous == 6)
     autonomousDrvSkills();
+  else if (selectedAutonomous == 7)
+    characterize::run();
+  else if (selectedAutonomous == 8)
+    characterize::benchmark(48, 3);
+  else if (selectedAutonomous == 9)
+    autonomousReplay();
   else
     autonomousOther(selectedAutonomous);
 
   // Stop the autonomous timer
 	competitionTimer->autonomousEndTimer();
 
+  // Save the sensor log and trace
+  sensorlog::stop();
+  sensorlog::save("/usd/sensors.log");
+  trace::end("Autonomous");
+  trace::stop();
+  trace::save("/usd/trace.txt");
+
   // Log the message to the message holder and set it to the screen
   messageHolder->appendLine("Autonomous took " + std::to_string(competitionTimer->autonomousTime()) + " ms");
+  timing::report();
   LCD::setText(6, "Auto took " + std::to_string(competitionTimer->autonomousTime()-2000) + " ms");
 }
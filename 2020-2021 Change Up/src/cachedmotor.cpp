@@ -0,0 +1,106 @@
+#include "main.h"
+
+std::uint32_t CachedMotor::sent = 0;
+std::uint32_t CachedMotor::saved = 0;
+CachedMotor * CachedMotor::motors[21];
+int CachedMotor::count = 0;
+
+CachedMotor::CachedMotor(std::uint8_t port, pros::motor_gearset_e_t gearset, bool reverse, pros::motor_encoder_units_e_t encoderUnits) : LoggedMotor(port, gearset, reverse, encoderUnits) {
+  // The constructor has already sent the encoder units and gearset
+  CachedMotor::encoderUnits = encoderUnits;
+  CachedMotor::gearset = gearset;
+  // Remember the motor so it can be invalidated with the others
+  if (count < 21)
+    motors[count++] = this;
+}
+
+// Returns whether a write changing the cached value to the given value should be sent, updating the cache
+bool CachedMotor::update(int & cached, int value, int & skips) {
+  if (cached == value && skips < REFRESH_SKIPS) {
+    skips++;
+    saved++;
+    return false;
+  }
+  cached = value;
+  skips = 0;
+  sent++;
+  return true;
+}
+
+// Returns whether a command should be sent, updating the cache
+bool CachedMotor::updateCommand(cached_command kind, int value) const {
+  // A change of command kind is always sent
+  if (command != kind) {
+    command = kind;
+    target = value;
+    commandSkips = 0;
+    sent++;
+    return true;
+  }
+  return update(target, value, commandSkips);
+}
+
+std::int32_t CachedMotor::move(std::int32_t voltage) const {
+  return updateCommand(E_CACHED_MOVE, voltage) ? LoggedMotor::move(voltage) : 1;
+}
+
+std::int32_t CachedMotor::move_voltage(std::int32_t voltage) const {
+  return updateCommand(E_CACHED_VOLTAGE, voltage) ? LoggedMotor::move_voltage(voltage) : 1;
+}
+
+std::int32_t CachedMotor::move_velocity(std::int32_t velocity) const {
+  return updateCommand(E_CACHED_VELOCITY, velocity) ? LoggedMotor::move_velocity(velocity) : 1;
+}
+
+std::int32_t CachedMotor::move_absolute(double position, std::int32_t velocity) const {
+  // Position moves are always sent, and replace the cached command
+  command = E_CACHED_NONE;
+  sent++;
+  return LoggedMotor::move_absolute(position, velocity);
+}
+
+std::int32_t CachedMotor::move_relative(double position, std::int32_t velocity) const {
+  command = E_CACHED_NONE;
+  sent++;
+  return LoggedMotor::move_relative(position, velocity);
+}
+
+std::int32_t CachedMotor::set_brake_mode(pros::motor_brake_mode_e_t mode) const {
+  return update(brakeMode, mode, brakeSkips) ? LoggedMotor::set_brake_mode(mode) : 1;
+}
+
+std::int32_t CachedMotor::set_encoder_units(pros::motor_encoder_units_e_t units) const {
+  return update(encoderUnits, units, encoderSkips) ? LoggedMotor::set_encoder_units(units) : 1;
+}
+
+std::int32_t CachedMotor::set_gearing(pros::motor_gearset_e_t gearset) const {
+  CachedMotor::gearset = gearset;
+  return LoggedMotor::set_gearing(gearset);
+}
+
+pros::motor_gearset_e_t CachedMotor::get_gearing() const {
+  return gearset;
+}
+
+// Forgets what was last sent, so the next write of each kind is sent
+void CachedMotor::invalidate() const {
+  command = E_CACHED_NONE;
+  brakeMode = -1;
+  encoderUnits = -1;
+}
+
+// Invalidates every cached motor
+void CachedMotor::invalidateAll() {
+  for (int i = 0; i < count; i++)
+    motors[i]->invalidate();
+}
+
+// Returns the amount of writes sent by every cached motor
+std::uint32_t CachedMotor::getWritesSent() {
+  return sent;
+}
+
+// Returns the amount of writes skipped by every cached motor
+std::uint32_t CachedMotor::getWritesSaved() {
+  return saved;
+}
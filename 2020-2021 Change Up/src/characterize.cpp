@@ -0,0 +1,190 @@
+#include "main.h"
+#include <cstdio>
+
+// Dump ports namespace for ease of use
+using namespace ports;
+
+namespace characterize {
+
+  // The sample period, matching the rate the motors update their encoders
+  const int SAMPLE_PERIOD = 10; // in ms
+  // The maximum amount of samples held in memory
+  const int MAX_SAMPLES = 2400;
+
+  // Recorded samples
+  Sample samples[MAX_SAMPLES];
+  int sampleCount = 0;
+
+  // Returns the average position of the drive motors, in inches
+  double drivePosition() {
+    return (frontLeftDrive->get_position() + backLeftDrive->get_position() + frontRightDrive->get_position() + backRightDrive->get_position()) / 4 / PID::getGearRatio();
+  }
+
+  // Sends the voltage command to all drive motors
+  void driveVoltage(double voltage) {
+    int millivolts = voltage * 1000;
+    frontLeftDrive->move_voltage(millivolts);
+    backLeftDrive->move_voltage(millivolts);
+    frontRightDrive->move_voltage(millivolts);
+    backRightDrive->move_voltage(millivolts);
+  }
+
+  // Runs the drive with the voltage given by the function of time, in ms, recording a sample every period
+  void runTest(int test, int duration, double (* voltage)(int time, double param), double param) {
+    int start = util::sign(pros::millis());
+    std::uint32_t wake = pros::millis();
+    double lastPosition = drivePosition();
+    double lastVelocity = 0;
+
+    // Prepare the drive
+    frontLeftDrive->set_brake_mode(BRAKE_COAST);
+    backLeftDrive->set_brake_mode(BRAKE_COAST);
+    frontRightDrive->set_brake_mode(BRAKE_COAST);
+    backRightDrive->set_brake_mode(BRAKE_COAST);
+
+    for (int time = 0; time <= duration && sampleCount < MAX_SAMPLES; time = util::sign(pros::millis()) - start) {
+      double commanded = voltage(time, param);
+      driveVoltage(commanded);
+
+      // Wait for the next sample, keeping the period fixed
+      pros::Task::delay_until(&wake, SAMPLE_PERIOD);
+
+      // Record the sample
+      double position = drivePosition();
+      double velocity = (position - lastPosition) * 1000.0 / SAMPLE_PERIOD;
+      Sample & sample = samples[sampleCount++];
+      sample.test = test;
+      sample.time = time;
+      sample.voltage = commanded;
+      sample.battery = pros::battery::get_voltage() / 1000.0;
+      sample.position = position;
+      sample.velocity = velocity;
+      sample.acceleration = (velocity - lastVelocity) * 1000.0 / SAMPLE_PERIOD;
+      lastPosition = position;
+      lastVelocity = velocity;
+    }
+
+    // Let the drive coast to a stop before the next test
+    driveVoltage(0);
+    pros::delay(1000);
+  }
+
+  // Runs the drive with a slowly increasing voltage, in volts per second, for the given duration in ms
+  void quasistatic(bool forward, double rampRate, int duration) {
+    struct Ramp {
+      static double voltage(int time, double rate) {
+        return rate * time / 1000.0;
+      }
+    };
+    runTest(forward ? QUASISTATIC_FORWARD : QUASISTATIC_BACKWARD, duration, Ramp::voltage, forward ? rampRate : -rampRate);
+  }
+
+  // Runs the drive with a constant voltage, in volts, for the given duration in ms
+  void stepVoltage(bool forward, double voltage, int duration) {
+    struct Step {
+      static double voltage(int, double step) {
+        return step;
+      }
+    };
+    runTest(forward ? STEP_FORWARD : STEP_BACKWARD, duration, Step::voltage, forward ? voltage : -voltage);
+  }
+
+  // Clears all recorded samples
+  void clear() {
+    sampleCount = 0;
+  }
+
+  // Writes all recorded samples to the given file as CSV, returning whether it was successful
+  bool save(std::string path) {
+    FILE * file = fopen(path.c_str(), "w");
+    if (file == NULL)
+      return false;
+
+    fputs("test,time,voltage,battery,position,velocity,acceleration\n", file);
+    for (int i = 0; i < sampleCount; i++) {
+      const Sample & sample = samples[i];
+      fprintf(file, "%d,%d,%.3f,%.3f,%.4f,%.4f,%.4f\n", sample.test, sample.time, sample.voltage, sample.battery, sample.position, sample.velocity, sample.acceleration);
+    }
+
+    fclose(file);
+    return true;
+  }
+
+  // Runs all of the characterization tests, driving forward and back alternately, and saves the samples
+  void run() {
+    clear();
+
+    LCD::setStatus("Characterizing: Quasistatic");
+    quasistatic(true, 1, 5000);
+    quasistatic(false, 1, 5000);
+
+    LCD::setStatus("Characterizing: Step");
+    stepVoltage(true, 6, 1500);
+    stepVoltage(false, 6, 1500);
+
+    // Restore the drive brake mode
+    frontLeftDrive->set_brake_mode(BRAKE_BRAKE);
+    backLeftDrive->set_brake_mode(BRAKE_BRAKE);
+    frontRightDrive->set_brake_mode(BRAKE_BRAKE);
+    backRightDrive->set_brake_mode(BRAKE_BRAKE);
+
+    if (save("/usd/characterize.csv"))
+      LCD::setStatus("Characterized: " + std::to_string(sampleCount) + " samples");
+    else
+      LCD::setStatus("Characterize: no SD card");
+  }
+
+  // Compares open-loop and cascaded control
+  void benchmark(double inches, int repetitions) {
+    bool wasCascaded = pid->isCascadedControl();
+    FILE * file = fopen("/usd/benchmark.csv", "w");
+    if (file != NULL)
+      fputs("cascaded,repetition,inches,time,settle,overshoot,error,heading\n", file);
+
+    for (int mode = 0; mode < 2; mode++) {
+      pid->setCascadedControl(mode);
+      LCD::setStatus(std::string("Benchmarking: ") + (mode ? "Cascaded" : "Open-loop"));
+
+      int totalTime = 0;
+      int totalSettle = 0;
+      int settledCount = 0;
+      double totalOvershoot = 0;
+      double totalError = 0;
+      double totalHeading = 0;
+      for (int i = 0; i < repetitions * 2; i++) {
+        double target = i % 2 ? -inches : inches;
+        double startHeading = gyro->getHeading();
+
+        // Time the move, then let the robot come to rest before measuring where it ended up
+        int start = util::sign(pros::millis());
+        pid->move(target);
+        int time = util::sign(pros::millis()) - start;
+        int settle = pid->getSettleTime();
+        double overshoot = pid->getOvershoot() / PID::getGearRatio();
+        pros::delay(500);
+        double error = target - drivePosition();
+        double heading = gyro->getHeading() - startHeading;
+
+        totalTime += time;
+        if (settle >= 0) {
+          totalSettle += settle;
+          settledCount++;
+        }
+        totalOvershoot += overshoot;
+        totalError += util::abs(error);
+        totalHeading += util::abs(heading);
+        if (file != NULL)
+          fprintf(file, "%d,%d,%.2f,%d,%d,%.3f,%.3f,%.3f\n", mode, i, target, time, settle, overshoot, error, heading);
+      }
+
+      // Summarize the averages on the LCD, on lines of their own. Settle time is averaged over the moves which settled
+      LCD::setText(11 + mode, std::string(mode ? "Cascaded" : "Open") + ": " + std::to_string(totalTime / (repetitions * 2)) + " ms, settle " + (settledCount ? std::to_string(totalSettle / settledCount) : std::string("none")) + " ms, overshoot " + std::to_string(totalOvershoot / (repetitions * 2)) + " in, error " + std::to_string(totalError / (repetitions * 2)) + " in, " + std::to_string(totalHeading / (repetitions * 2)) + " deg");
+    }
+
+    if (file != NULL)
+      fclose(file);
+    pid->setCascadedControl(wasCascaded);
+    LCD::setStatus("Benchmark complete");
+  }
+
+}
@@ -7,28 +7,28 @@ namespace ports {
   pros::Controller * controllerMain = new pros::Controller(CONTROLLER_MASTER);
   pros::Controller * controllerPartner = new pros::Controller(CONTROLLER_PARTNER);
 
-  // Motors
+  // Motors, skipping repeated writes and recording to the sensor log
   pros::Motor * emptyPort = new pros::Motor(2);
-  pros::Motor * port1 = new pros::Motor(1, GEARSET_200, FWD, ENCODER_DEGREES); 
+  pros::Motor * port1 = new CachedMotor(1, GEARSET_200, FWD, ENCODER_DEGREES); 
   pros::Motor * port2 = NULL; 
   pros::Motor * port3 = NULL;
   pros::Motor * port4 = NULL; 
-  pros::Motor * port5 = new pros::Motor(5, GEARSET_200, FWD, ENCODER_DEGREES); 
-  pros::Motor * port6 = new pros::Motor(6, GEARSET_200, FWD, ENCODER_DEGREES); 
-  pros::Motor * port7 = new pros::Motor(7, GEARSET_200, REV, ENCODER_DEGREES);
+  pros::Motor * port5 = new CachedMotor(5, GEARSET_200, FWD, ENCODER_DEGREES); 
+  pros::Motor * port6 = new CachedMotor(6, GEARSET_200, FWD, ENCODER_DEGREES); 
+  pros::Motor * port7 = new CachedMotor(7, GEARSET_200, REV, ENCODER_DEGREES);
   pros::Motor * port8 = NULL;
   pros::Motor * port9 = NULL;
-  pros::Motor * port10 = new pros::Motor(10, GEARSET_200, REV, ENCODER_DEGREES); 
+  pros::Motor * port10 = new CachedMotor(10, GEARSET_200, REV, ENCODER_DEGREES); 
   pros::Motor * port11 = NULL;
-  pros::Motor * port12 = new pros::Motor(12, GEARSET_200, REV, ENCODER_DEGREES);
+  pros::Motor * port12 = new CachedMotor(12, GEARSET_200, REV, ENCODER_DEGREES);
   pros::Motor * port13 = NULL;
   pros::Motor * port14 = NULL;
   pros::Motor * port15 = NULL; 
-  pros::Motor * port16 = new pros::Motor(16, GEARSET_200, FWD, ENCODER_DEGREES); 
+  pros::Motor * port16 = new CachedMotor(16, GEARSET_200, FWD, ENCODER_DEGREES); 
   pros::Motor * port17 = NULL;
   pros::Motor * port18 = NULL;
   pros::Motor * port19 = NULL;
-  pros::Motor * port20 = new pros::Motor(20, GEARSET_600, REV, ENCODER_DEGREES);
+  pros::Motor * port20 = new CachedMotor(20, GEARSET_600, REV, ENCODER_DEGREES);
   pros::Motor * port21 = NULL;
 
   // Port mapping
@@ -44,7 +44,7 @@ namespace ports {
   // Vision sensor
 
   // Inertial sensor
-  pros::Imu * imu = new pros::Imu(15);
+  pros::Imu * imu = new LoggedImu(15);
 
   // ADI (3-wire) ports
   pros::ADIUltrasonic * intakeUltrasonic = new pros::ADIUltrasonic('A', 'B');
@@ -52,6 +52,15 @@ namespace ports {
   // Gyro manager
   Gyro * gyro = new Gyro(imu);
 
+  // Controller input manager
+  ControllerInput * input = new ControllerInput(controllerMain, controllerPartner);
+
+  // Driver run recorder
+  DriveRecorder * recorder = new DriveRecorder();
+
+  // Task profiler
+  TaskProfiler * profiler = new TaskProfiler();
+
   // PID manager
   PID * pid = new PID();
 
@@ -61,7 +70,9 @@ namespace ports {
 
   // Tasks
   pros::Task * gyroTask = NULL; // To be initialized during the initialization routine
+  pros::Task * inputTask = NULL; // To be initialized during the initialization routine
   pros::Task * mhTask = NULL; // To be initialized during the initialization routine
+  pros::Task * profilerTask = NULL; // To be initialized during the initialization routine
 
 }
 
@@ -76,3 +87,12 @@ std::string postResult = "";
 // Driver Skills auto running
 bool driverSkillsRunning = false;
 
+// Field-centric driving, and the heading treated as forward
+bool fieldCentric = false;
+double fieldCentricZero = 0;
+
+// Driver input profiles and the selected profile, with the curves configured during the initialization routine
+DriverProfile * driverProfiles[] = {new DriverProfile("Default"), new DriverProfile("Precise")};
+const int driverProfileCount = 2;
+int selectedDriver = 0;
+
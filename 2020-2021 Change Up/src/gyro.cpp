@@ -15,40 +15,46 @@ void Gyro::task() {
   Gyro::headingRotations = 0;
 
   while (true) {
-
-    // Handle roll overflowing
-    double roll = imu->get_roll();
-    if (roll < -90.0 && Gyro::rollLastRead > 90.0)
-      rollRotations++;
-    if (roll > 90.0 && Gyro::rollLastRead < -90.0)
-      rollRotations--;
-    // Store the last roll
-    Gyro::rollLastRead = roll;
-
-    // Handle pitch overflowing
-    double pitch = imu->get_pitch();
-    if (pitch < -90.0 && Gyro::pitchLastRead > 90.0)
-      pitchRotations++;
-    if (pitch > 90.0 && Gyro::pitchLastRead < -90.0)
-      pitchRotations--;
-    // Store the last pitch
-    Gyro::pitchLastRead = pitch;
-
-    // Handle pitch overflowing
-    double yaw = imu->get_yaw();
-    if (yaw < -90.0 && Gyro::headingLastRead > 90.0)
-      headingRotations++;
-    if (yaw > 90.0 && Gyro::headingLastRead < -90.0)
-      headingRotations--;
-
-    // Store the last heading
-    Gyro::headingLastRead = yaw;
+    Gyro::update();
 
     // Run every 15 ms
     pros::delay(15);
   }
 }
 
+// Reads the sensor once, tracking overflows; called by the task every 15 ms
+void Gyro::update() {
+  TIME_SCOPE(E_TIMING_GYRO_UPDATE);
+  // Handle roll overflowing
+  double roll = imu->get_roll();
+  if (roll < -90.0 && Gyro::rollLastRead > 90.0)
+    rollRotations++;
+  if (roll > 90.0 && Gyro::rollLastRead < -90.0)
+    rollRotations--;
+  // Store the last roll
+  Gyro::rollLastRead = roll;
+
+  // Handle pitch overflowing
+  double pitch = imu->get_pitch();
+  if (pitch < -90.0 && Gyro::pitchLastRead > 90.0)
+    pitchRotations++;
+  if (pitch > 90.0 && Gyro::pitchLastRead < -90.0)
+    pitchRotations--;
+  // Store the last pitch
+  Gyro::pitchLastRead = pitch;
+
+  // Handle pitch overflowing
+  double yaw = imu->get_yaw();
+  if (yaw < -90.0 && Gyro::headingLastRead > 90.0)
+    headingRotations++;
+  if (yaw > 90.0 && Gyro::headingLastRead < -90.0)
+    headingRotations--;
+
+  // Store the last heading
+  Gyro::headingLastRead = yaw;
+  Gyro::headingCache.store(yaw + 360.0 * Gyro::headingRotations, std::memory_order_release);
+}
+
 Gyro::Gyro(pros::Imu * imu) {
   // Sets the imu to the given one
   Gyro::imu = imu;
@@ -69,6 +75,11 @@ double Gyro::getHeading() {
   return Gyro::imu->get_yaw() + 360.0 * Gyro::headingRotations - headingZero;
 }
 
+// Returns the heading last read by the task, without reading the sensor
+double Gyro::getCachedHeading() {
+  return Gyro::headingCache.load(std::memory_order_acquire) - headingZero;
+}
+
 // Passthrough for acceleration
 pros::c::imu_accel_s_t Gyro::getAcceleration() {
   return Gyro::imu->get_accel();
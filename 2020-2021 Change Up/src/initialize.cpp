@@ -139,15 +139,45 @@ void initialize() {
 	ports::pid->setStrafeVelPID(7, 0.000, 0);
 	ports::pid->setForwardAcceleration(1.031, 9, 75);
 	ports::pid->setBackwardAcceleration(1.02, 8, 100);
+	// Drive feedforward is off until the robot has been characterized. Set the constants tools/characterize.cpp prints
+	// from the robot's samples to ramp and slow at 60 in/s^2 instead
+	ports::pid->setDriveFeedforward(0, 0, 0, 60);
+
+	// End motions once the robot has settled or is pushing against something. The error windows sit just above the
+	// default exit thresholds, so a robot stopped short of its threshold still settles, and the stall power is at the
+	// minimum power, so a robot held at the minimum power against something stalls
+	ports::pid->setMoveSettle(12, 60, 100);
+	ports::pid->setMoveStall(15, 30, 300);
+	ports::pid->setStrafeSettle(30, 60, 100);
+	ports::pid->setStrafeStall(15, 30, 300);
+	ports::pid->setPivotSettle(3, 8, 100);
+	ports::pid->setPivotStall(2, 30, 300);
+
+	LCD::setStatus("Initializing driver profiles");
+	// Precompute the driver response curves
+	driverProfiles[0]->move.configure(5, 0, 0);
+	driverProfiles[0]->turn.configure(5, 0.3, 0);
+	driverProfiles[0]->strafe.configure(5, 0, 0);
+	driverProfiles[1]->move.configure(8, 0.5, 12);
+	driverProfiles[1]->turn.configure(8, 0.7, 12);
+	driverProfiles[1]->strafe.configure(8, 0.5, 12);
 
 	ports::pid->setNoStopDebug(false);
 	ports::pid->setLoggingDebug(false);
 
+	// Flag tasks using most of the CPU or close to overflowing their stack
+	ports::profiler->setLimits(80, 512);
+	ports::profiler->setReporting(false);
+
 	LCD::setStatus("Initializing: Tasks");
 	// Start gyroscope tracking
 	ports::gyroTask = new pros::Task(gyroTask, NULL, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, "Gyro");
+	// Start controller sampling, above the control loops so input is not delayed by them
+	ports::inputTask = new pros::Task(inputTask, NULL, TASK_PRIORITY_DEFAULT + 1, TASK_STACK_DEPTH_DEFAULT, "Input");
 	// Start message debugging if the debugger is attached
 	ports::mhTask = new pros::Task(mhTask, NULL, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, "Message Handler");
+	// Start task profiling, below the other tasks so it only runs when they are idle
+	ports::profilerTask = new pros::Task(profilerTask, NULL, TASK_PRIORITY_MIN + 1, TASK_STACK_DEPTH_DEFAULT, "Profiler");
 	postPass = true;
 	return;
 	LCD::setStatus("Power on self-test...");
@@ -176,6 +206,18 @@ void initialize() {
  */
 void disabled() {
 	LCD::setStatus("Disabled");
+	// The motors are stopped while disabled, so send the next command whatever was last sent
+	CachedMotor::invalidateAll();
+
+	// Save the sensor log if autonomous was ended before it finished
+	if (sensorlog::isLogging()) {
+		sensorlog::stop();
+		sensorlog::save("/usd/sensors.log");
+	}
+	if (trace::isTracing()) {
+		trace::stop();
+		trace::save("/usd/trace.txt");
+	}
 }
 
 /**
@@ -196,8 +238,13 @@ void competition_initialize() {
 		LCD::printDebugInformation();
 
 		// Maps the left and right buttons on the controller to the left and right buttons on the Brain LCD
-		if (ports::controllerMain->get_digital_new_press(BUTTON_LEFT)) LCD::onLeftButton();
-		if (ports::controllerMain->get_digital_new_press(BUTTON_RIGHT)) LCD::onRightButton();
+		InputEvent event;
+		while (ports::input->nextEvent(event)) {
+			if (event.controller != CONTROLLER_MAIN || event.type != E_INPUT_PRESS)
+				continue;
+			if (event.button == BUTTON_LEFT) LCD::onLeftButton();
+			if (event.button == BUTTON_RIGHT) LCD::onRightButton();
+		}
 
 		// Update the LCD screen
 		LCD::updateScreen();
@@ -0,0 +1,222 @@
+#include "main.h"
+
+// Constructs the InputCurve object with a linear response
+InputCurve::InputCurve() {
+  configure(0, 0, 0);
+}
+
+// Precomputes the response table
+void InputCurve::configure(int deadband, double expo, int slew) {
+  InputCurve::slew = slew;
+  InputCurve::last = 0;
+
+  for (int i = 0; i < 256; i++) {
+    int value = util::limit127(i - 128);
+
+    // Remove the deadband and normalize what remains to a magnitude of 0 to 1
+    double magnitude = (util::abs(value) - deadband) / (127.0 - deadband);
+    if (magnitude <= 0 || deadband >= 127) {
+      table[i] = 0;
+      continue;
+    }
+
+    // Blend the linear and cubic responses and scale back to ±127
+    magnitude = (1 - expo) * magnitude + expo * magnitude * magnitude * magnitude;
+    table[i] = (value < 0 ? -1 : 1) * (int) (magnitude * 127 + 0.5);
+  }
+}
+
+// Returns the shaped output for the given stick value
+int InputCurve::shape(int value) {
+  int output = table[(util::limit127(value) + 128) & 0xFF];
+
+  // Limit how quickly the output can grow, leaving decreases immediate. A reversal grows from 0, as the old
+  // direction has been released
+  if (output * last < 0)
+    last = 0;
+  if (slew > 0 && util::abs(output) > util::abs(last)) {
+    if (output > last + slew)
+      output = last + slew;
+    else if (output < last - slew)
+      output = last - slew;
+  }
+
+  last = output;
+  return output;
+}
+
+// Constructs the DriverProfile object with linear responses
+DriverProfile::DriverProfile(std::string name) {
+  DriverProfile::name = name;
+}
+
+// Task to be given to the global ControllerInput object
+void inputTask(void * param) {
+  ports::input->task();
+}
+
+// Constructs the ControllerInput object with the given controllers
+ControllerInput::ControllerInput(pros::Controller * controllerMain, pros::Controller * controllerPartner) {
+  ControllerInput::controllers[0] = controllerMain;
+  ControllerInput::controllers[1] = controllerPartner;
+}
+
+// Adds an event to the queue, dropping it if the queue is full
+void ControllerInput::push(int controller, int button, input_event_type type, std::uint32_t time) {
+  int current = head.load(std::memory_order_relaxed);
+  int next = (current + 1) % QUEUE_SIZE;
+  if (next == tail.load(std::memory_order_acquire)) {
+    dropped++;
+    return;
+  }
+
+  InputEvent & event = queue[current];
+  event.controller = (pros::controller_id_e_t) controller;
+  event.button = (pros::controller_digital_e_t) (button + BUTTON_L1);
+  event.type = type;
+  event.time = time;
+  head.store(next, std::memory_order_release);
+}
+
+// Updates the debounced state of a button, queueing events for any change or hold
+void ControllerInput::setButton(int controller, int button, bool pressed, std::uint32_t time) {
+  if (pressed != digital[controller][button]) {
+    digital[controller][button] = pressed;
+    held[controller][button] = false;
+    pressTime[controller][button] = time;
+    push(controller, button, pressed ? E_INPUT_PRESS : E_INPUT_RELEASE, time);
+  }
+
+  // Signal a hold once the button has been pressed long enough
+  if (digital[controller][button] && !held[controller][button] && time - pressTime[controller][button] >= HOLD_TIME * 1000) {
+    held[controller][button] = true;
+    push(controller, button, E_INPUT_HOLD, time);
+  }
+}
+
+// Replaces the main controller with the next frame of the recording being replayed
+void ControllerInput::replay(std::uint32_t time) {
+  int values[4] = {};
+  int buttons = 0;
+
+  // Once the recording ends, the sticks are centred and the buttons released
+  if (!ports::recorder->playback(values, buttons)) {
+    for (int a = 0; a < 4; a++)
+      values[a] = 0;
+    buttons = 0;
+  }
+
+  for (int a = 0; a < 4; a++)
+    analog[0][a] = values[a];
+  for (int b = 0; b < 12; b++)
+    setButton(0, b, buttons & (1 << b), time);
+}
+
+// Task sampling the controllers
+void ControllerInput::task() {
+  std::uint32_t wake = pros::millis();
+
+  while (true) {
+    std::uint32_t now = util::micros();
+    // Recording and replay run every other sample
+    bool frame = samples++ % 2 == 0;
+
+    for (int c = 0; c < 2; c++) {
+      // While replaying, the recording takes the place of the main controller
+      if (c == 0 && ports::recorder->isReplaying()) {
+        if (frame)
+          replay(now);
+        continue;
+      }
+
+      // A disconnected controller has its sticks centred and its buttons released, so it stops driving
+      pros::Controller * controller = controllers[c];
+      if (controller == NULL || !controller->is_connected()) {
+        for (int a = 0; a < 4; a++)
+          analog[c][a] = 0;
+        for (int b = 0; b < 12; b++) {
+          unstable[c][b] = 0;
+          setButton(c, b, false, now);
+        }
+        continue;
+      }
+
+      // Cache the stick values
+      for (int a = 0; a < 4; a++)
+        analog[c][a] = controller->get_analog((pros::controller_analog_e_t) a);
+
+      for (int b = 0; b < 12; b++) {
+        bool pressed = controller->get_digital((pros::controller_digital_e_t) (b + BUTTON_L1));
+
+        // Only accept a change once it has been stable for the debounce period
+        if (pressed == digital[c][b])
+          unstable[c][b] = 0;
+        else if (++unstable[c][b] >= DEBOUNCE_SAMPLES) {
+          unstable[c][b] = 0;
+          pressed = !digital[c][b];
+        } else
+          pressed = digital[c][b];
+        setButton(c, b, pressed, now);
+      }
+
+      // Record the main controller, leaving out the button that runs autonomous
+      if (c == 0 && frame && ports::recorder->isRecording()) {
+        int buttons = 0;
+        for (int b = 0; b < 12; b++)
+          if (digital[0][b] && b + BUTTON_L1 != BUTTON_UP)
+            buttons |= 1 << b;
+        ports::recorder->record(analog[0], buttons);
+      }
+    }
+
+    pros::Task::delay_until(&wake, SAMPLE_PERIOD);
+  }
+}
+
+// Takes the next event from the queue, returning false if there are none
+bool ControllerInput::nextEvent(InputEvent & event) {
+  int current = tail.load(std::memory_order_relaxed);
+  if (current == head.load(std::memory_order_acquire))
+    return false;
+
+  event = queue[current];
+  tail.store((current + 1) % QUEUE_SIZE, std::memory_order_release);
+
+  // Record how long the event waited to be consumed
+  std::uint32_t latency = util::micros() - event.time;
+  if (latency > latencyMax)
+    latencyMax = latency;
+  latencyTotal += latency;
+  latencyCount++;
+  return true;
+}
+
+// Discards all queued events
+void ControllerInput::clearEvents() {
+  tail.store(head.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+// Returns the last stick value read
+int ControllerInput::getAnalog(pros::controller_id_e_t controller, pros::controller_analog_e_t channel) {
+  return analog[controller][channel];
+}
+
+// Returns whether the button is held down, after debouncing
+bool ControllerInput::getDigital(pros::controller_id_e_t controller, pros::controller_digital_e_t button) {
+  return digital[controller][button - BUTTON_L1];
+}
+
+// Returns the maximum latency between events being detected and consumed
+std::uint32_t ControllerInput::getMaxLatency() {
+  return latencyMax;
+}
+
+// Returns the average latency between events being detected and consumed
+std::uint32_t ControllerInput::getAverageLatency() {
+  return latencyCount ? latencyTotal / latencyCount : 0;
+}
+
+// Returns the amount of events dropped because the queue was full
+int ControllerInput::getDroppedEvents() {
+  return dropped;
+}
@@ -0,0 +1,33 @@
+#include "main.h"
+
+namespace kinematics {
+
+  // Converts the forward, strafe and turn commands into wheel powers
+  WheelPowers inverse(double forward, double strafe, double turn) {
+    WheelPowers powers;
+    powers.frontLeft = forward + turn + strafe;
+    powers.backLeft = forward + turn - strafe;
+    powers.frontRight = forward - turn - strafe;
+    powers.backRight = forward - turn + strafe;
+    return powers;
+  }
+
+  // Scales all wheel powers down by the same factor if any exceeds the maximum power
+  void desaturate(WheelPowers & powers, double maxPower) {
+    // Find the largest wheel power
+    double largest = util::abs(powers.frontLeft);
+    if (util::abs(powers.backLeft) > largest) largest = util::abs(powers.backLeft);
+    if (util::abs(powers.frontRight) > largest) largest = util::abs(powers.frontRight);
+    if (util::abs(powers.backRight) > largest) largest = util::abs(powers.backRight);
+
+    // Scale all wheels to keep their ratios if it cannot be reached
+    if (largest <= maxPower)
+      return;
+    double scale = maxPower / largest;
+    powers.frontLeft *= scale;
+    powers.backLeft *= scale;
+    powers.frontRight *= scale;
+    powers.backRight *= scale;
+  }
+
+}
@@ -64,12 +64,17 @@ void LCD::updateScreen(bool forceController) {
 }
 
 void LCD::printDebugInformation() {
+  TIME_SCOPE(E_TIMING_LCD_UPDATE);
   // Print gyro heading
   LCD::setText(2, std::to_string(ports::gyro->getHeading()));
   // Print temperature sensors for critical motors
   LCD::setText(3, "Left: " + std::to_string((int) ports::intakeMotorLeft->get_temperature()) + ", Right: " + std::to_string((int) ports::intakeMotorRight->get_temperature()));
   LCD::setText(4, "Flywheel: " + std::to_string((int) ports::flywheel->get_temperature()));
   LCD::setText(5, "Ultrasonic: " + std::to_string(ports::intakeUltrasonic->get_value()));
+  // Print the motor writes skipped as repeats
+  LCD::setText(10, "Motor writes: " + std::to_string(CachedMotor::getWritesSent()) + " sent, " + std::to_string(CachedMotor::getWritesSaved()) + " saved");
+  // Print the controller input latency
+  LCD::setText(9, "Input latency: " + std::to_string(ports::input->getAverageLatency()) + " us avg, " + std::to_string(ports::input->getMaxLatency()) + " us max");
 
 }
 
@@ -91,7 +96,7 @@ void LCD::setControllerText(std::string text) {
 
 void LCD::setText(int line, std::string text) {
   // Sets the text at a given line on the LCD
-  if (line > 9 || line < 0)
+  if (line > 12 || line < 0)
     return;
   pros::lcd::set_text(line + 1, text);
   lines.at(line + 1) = text;
@@ -104,7 +109,7 @@ std::string LCD::getStatus() {
 
 std::string LCD::getText(int line) {
   // Returns the text at a given line on the LCD
-  if (line > 9 || line < 0)
+  if (line > 12 || line < 0)
     return "";
   return lines.at(line + 1);
 }
@@ -126,6 +131,12 @@ std::string LCD::getAutonomousName() {
       return "Skills";
     case 6:
       return "Drv. Skills";
+    case 7:
+      return "Characterize";
+    case 8:
+      return "Benchmark";
+    case 9:
+      return "Replay";
     default:
       return (std::to_string(selectedAutonomous) + (isAutonomousRed() ? " (Red)" : " (Blue)"));
   }
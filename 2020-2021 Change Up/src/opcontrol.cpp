@@ -7,26 +7,47 @@
 // Dump ports namespace for ease of use
 using namespace ports;
 
-// Drives the robot based on the given controller
-void drive(pros::Controller * controller) {
+// Drives the robot based on the given controller, compensating for the filtered battery voltage
+void drive(pros::controller_id_e_t controller, double battery) {
+	// Shape the stick values with the selected driver's response curves
+	DriverProfile * profile = driverProfiles[selectedDriver];
 	// Set the forward and backward movement
-	int movePower = controller->get_analog(STICK_LEFT_Y);
+	int movePower = profile->move.shape(input->getAnalog(controller, STICK_LEFT_Y));
 	// Treat the drive left/right as turning
-	int turnPower = controller->get_analog(STICK_LEFT_X);
+	int turnPower = profile->turn.shape(input->getAnalog(controller, STICK_LEFT_X));
 	// Treat the secondary left/right as strafing
-	int strafePower = controller->get_analog(STICK_RIGHT_X);
+	int strafePower = profile->strafe.shape(input->getAnalog(controller, STICK_RIGHT_X));
+
+	// When replaying a recorded run, steer back towards the heading the robot had when recording
+	turnPower += recorder->getTurnCorrection();
+
+	// If driving field-centric, rotate the movement from the field to the robot using the last heading read
+	double forward = movePower;
+	double strafe = strafePower;
+	if (fieldCentric) {
+		double heading = (gyro->getCachedHeading() - fieldCentricZero) * PI / 180.0;
+		forward = movePower * std::cos(heading) + strafePower * std::sin(heading);
+		strafe = strafePower * std::cos(heading) - movePower * std::sin(heading);
+	}
+
+	// Steer back towards where the robot was when recording. The move correction is along the way the robot faced
+	// in the recording, so rotate it from the recorded heading to the current one, whichever frame the sticks are in
+	double moveCorrection = recorder->getMoveCorrection();
+	if (moveCorrection != 0) {
+		double offset = (recorder->getCorrectionHeading() - gyro->getCachedHeading()) * PI / 180.0;
+		forward += moveCorrection * std::cos(offset);
+		strafe += moveCorrection * std::sin(offset);
+	}
 
-	// Calculate the powers for each motor
-	int frontLeftPower = movePower + turnPower + strafePower;
-	int backLeftPower = movePower + turnPower - strafePower;
-	int frontRightPower = movePower - turnPower - strafePower;
-	int backRightPower = movePower - turnPower + strafePower;
+	// Calculate the powers for each motor, keeping the direction of travel when at full power
+	kinematics::WheelPowers powers = kinematics::inverse(forward, strafe, turnPower);
+	kinematics::desaturate(powers);
 
 	// Assign motor powers
-	frontLeftDrive->move(frontLeftPower);
-	backLeftDrive->move(backLeftPower);
-	frontRightDrive->move(frontRightPower);
-	backRightDrive->move(backRightPower);
+	frontLeftDrive->move_voltage(util::powerToVoltage(powers.frontLeft, battery));
+	backLeftDrive->move_voltage(util::powerToVoltage(powers.backLeft, battery));
+	frontRightDrive->move_voltage(util::powerToVoltage(powers.frontRight, battery));
+	backRightDrive->move_voltage(util::powerToVoltage(powers.backRight, battery));
 }
 
 /**
@@ -53,48 +74,92 @@ void opcontrol() {
 
 	// Sets the status on the LCD
 	LCD::setStatus("Operator Control");
+	// The motors were stopped while disabled, so send every command afresh
+	CachedMotor::invalidateAll();
 
 	// Start the operator control timer
 	competitionTimer->opcontrolStartTimer();
 
+	// Discard presses made before operator control, such as while disabled
+	input->clearEvents();
+
 	// Flag for braking the flywheel motor
 	bool holdflag = false;
 
 	while (true) {
+		// Sample the battery once for every motor command in this cycle
+		double battery = util::sampleBattery();
+
 		// Drives the robot with the main controller
-		drive(controllerMain);
+		drive(CONTROLLER_MAIN, battery);
 
 		// Maps the right trigger buttons to intake and outtake the balls
 		int intakeSpeed = 0;
-		if (controllerMain->get_digital(BUTTON_R1))
+		if (input->getDigital(CONTROLLER_MAIN, BUTTON_R1))
 			intakeSpeed = 127;
-		else if (controllerMain->get_digital(BUTTON_R2) || controllerMain->get_digital(BUTTON_A))
+		else if (input->getDigital(CONTROLLER_MAIN, BUTTON_R2) || input->getDigital(CONTROLLER_MAIN, BUTTON_A))
 			intakeSpeed = -127;
-		intakeMotorLeft->move(intakeMotorLeft->get_efficiency() < 25 && intakeSpeed > 0 ? 127 : intakeSpeed);
-		intakeMotorRight->move(intakeMotorRight->get_efficiency() < 25 && intakeSpeed > 0 ? 127 : intakeSpeed);
+		intakeMotorLeft->move_voltage(util::powerToVoltage(intakeMotorLeft->get_efficiency() < 25 && intakeSpeed > 0 ? 127 : intakeSpeed, battery));
+		intakeMotorRight->move_voltage(util::powerToVoltage(intakeMotorRight->get_efficiency() < 25 && intakeSpeed > 0 ? 127 : intakeSpeed, battery));
 
-		bool outtake = controllerMain->get_digital(BUTTON_R2) || controllerMain->get_digital(DIGITAL_L2);
+		bool outtake = input->getDigital(CONTROLLER_MAIN, BUTTON_R2) || input->getDigital(CONTROLLER_MAIN, BUTTON_L2);
 		// Indexer speed control
-		int indexerSpeed = controllerMain->get_digital(BUTTON_L1) * 127;
+		int indexerSpeed = input->getDigital(CONTROLLER_MAIN, BUTTON_L1) * 127;
 		if (indexerSpeed == 0 && intakeSpeed > 50)
 			indexerSpeed = 127;
-		indexer->move(outtake ? -127 : indexerSpeed);
+		indexer->move_voltage(util::powerToVoltage(outtake ? -127 : indexerSpeed, battery));
 
 		// Flywheel speed control
-		int flywheelSpeed = controllerMain->get_digital(BUTTON_L1) * 127;
+		int flywheelSpeed = input->getDigital(CONTROLLER_MAIN, BUTTON_L1) * 127;
 		if (flywheelSpeed == 0 && indexerSpeed > 50)
 			flywheelSpeed = -16;
-		flywheel->move(outtake ? -127 : flywheelSpeed);
+		flywheel->move_voltage(util::powerToVoltage(outtake ? -127 : flywheelSpeed, battery));
 
 		// Prints debug information to the LCD
 		LCD::printDebugInformation();
 
-		// Maps the left and right buttons on the controller to the left and right buttons on the Brain LCD
-		if (controllerMain->get_digital_new_press(BUTTON_LEFT)) LCD::onLeftButton();
-		if (controllerMain->get_digital_new_press(BUTTON_RIGHT)) LCD::onRightButton();
-
-		// If the up button is pressed, run autonomous
-		if (controllerMain->get_digital_new_press(BUTTON_UP)) autonomous();
+		// Handle the button presses on the main controller since the last loop
+		InputEvent event;
+		while (input->nextEvent(event)) {
+			if (event.controller != CONTROLLER_MAIN || event.type != E_INPUT_PRESS)
+				continue;
+
+			switch (event.button) {
+				// Maps the left and right buttons on the controller to the left and right buttons on the Brain LCD
+				case BUTTON_LEFT:
+					LCD::onLeftButton();
+					break;
+				case BUTTON_RIGHT:
+					LCD::onRightButton();
+					break;
+
+				// Toggles field-centric driving with Y, and sets the current heading as forward with B
+				case BUTTON_Y:
+					fieldCentric = !fieldCentric;
+					LCD::setControllerText(fieldCentric ? "Field-centric" : "Robot-centric");
+					controllerMain->rumble(fieldCentric ? ".." : ".");
+					break;
+				case BUTTON_B:
+					fieldCentricZero = gyro->getCachedHeading();
+					controllerMain->rumble("-");
+					break;
+
+				// Cycles through the driver profiles with down
+				case BUTTON_DOWN:
+					selectedDriver = (selectedDriver + 1) % driverProfileCount;
+					LCD::setControllerText("Driver: " + driverProfiles[selectedDriver]->name);
+					break;
+
+				// If the up button is pressed, run autonomous, ignoring any presses made while it ran
+				case BUTTON_UP:
+					autonomous();
+					input->clearEvents();
+					break;
+
+				default:
+					break;
+			}
+		}
 
 		// Update the LCD screen
 		LCD::updateScreen();
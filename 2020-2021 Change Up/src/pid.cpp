@@ -1,4 +1,5 @@
 #include "main.h"
+#include <cmath>
 
 // Dump ports namespace for ease of use
 using namespace ports;
@@ -24,6 +25,25 @@ bool PID::continuePIDLoop(bool expr) {
   return expr;
 }
 
+// Records how the motion tracked by the given settle detector ended
+void PID::finishMotion(SettleDetector & settler, std::string name, double error, bool timedOut) {
+  PID::lastStalled = settler.isStalled();
+  PID::lastTimedOut = timedOut && !settler.isSettled() && !settler.isStalled();
+  PID::lastSettleTime = settler.getSettleTime();
+  PID::lastOvershoot = settler.getOvershoot();
+
+  // Log it to the message holder if the flag is set
+  if (logPIDErrors && settler.isStalled())
+    messageHolder->appendLine(name + " stalled");
+  else if (logPIDErrors && settler.isSettled())
+    messageHolder->appendLine(name + " settled");
+  else if (logPIDErrors && PID::lastTimedOut)
+    messageHolder->appendLine(name + " timed out");
+
+  if (motionCallback)
+    motionCallback(name, error);
+}
+
 // Sets the brake mode
 void PID::setBrakeMode() {
   frontLeftDrive->set_brake_mode(BRAKE_BRAKE);
@@ -32,6 +52,28 @@ void PID::setBrakeMode() {
   backRightDrive->set_brake_mode(BRAKE_BRAKE);
 }
 
+// Sends a power command to a drive motor, as a voltage or as a velocity setpoint if using cascaded control
+void PID::commandMotor(pros::Motor * motor, double power, double battery) {
+  if (!cascaded) {
+    motor->move_voltage(util::powerToVoltage(power, battery));
+    return;
+  }
+
+  // Scale the power to the maximum velocity of the motor's gearset
+  double maxVelocity = 200;
+  switch (motor->get_gearing()) {
+    case GEARSET_100:
+      maxVelocity = 100;
+      break;
+    case GEARSET_600:
+      maxVelocity = 600;
+      break;
+    default:
+      break;
+  }
+  motor->move_velocity(util::limit127(power) / 127.0 * maxVelocity);
+}
+
 // Returns the power given the minimum and maximum power restraints
 double PID::checkPower(double power) {
   if (!power);
@@ -40,12 +82,55 @@ double PID::checkPower(double power) {
   return power;
 }
 
+// Takes the chaining request for the motion about to start, returning whether it is chained
+bool PID::takeChain() {
+  bool chained = chainRequested;
+  chainRequested = false;
+  return chained;
+}
+
+// Ends the motion, handing off to the next motion at the exit power if chained, otherwise stopping the drive
+void PID::endMotion(bool chained, double direction, double remaining) {
+  chainRequested = false;
+
+  // Stop the motors if the motion is not chained
+  if (!chained || noStop) {
+    chainPower = 0;
+    chainDistance = 0;
+    powerDrive(0, 0);
+    return;
+  }
+
+  // Keep the drive running and record what is handed off
+  chainPower = direction < 0 ? -chainExitPower : chainExitPower;
+  chainDistance = remaining;
+  powerDrive(chainPower, chainPower);
+}
+
+// Chains the next move, velocity move or pivot into the motion following it
+void PID::chain(double exitPower, double exitTolerance, int nextDirection) {
+  PID::chainRequested = true;
+  PID::chainExitPower = util::abs(exitPower);
+  PID::chainExitTolerance = util::abs(exitTolerance);
+  PID::chainNextDirection = nextDirection < 0 ? -1 : 1;
+}
+
 // Sets the power limits of PID
 void PID::setPowerLimits(int maxPower, int minPower) {
   PID::maxPower = maxPower;
   PID::minPower = minPower;
 }
 
+// Sets whether to use cascaded control
+void PID::setCascadedControl(bool flag) {
+  PID::cascaded = flag;
+}
+
+// Returns whether cascaded control is being used
+bool PID::isCascadedControl() {
+  return PID::cascaded;
+}
+
 // Sets the move positional PID values
 void PID::setMovePosPID(double movekp, double moveki, double movekd) {
   PID::movekp = movekp;
@@ -101,6 +186,69 @@ void PID::setVelocityGyro(Gyro * g) {
   PID::velocityGyroValue = 0;
 }
 
+// Sets the drive feedforward constants and the acceleration to ramp up at
+void PID::setDriveFeedforward(double kS, double kV, double kA, double acceleration) {
+  PID::feedforwardkS = kS;
+  PID::feedforwardkV = kV;
+  PID::feedforwardkA = kA;
+  PID::feedforwardAccel = acceleration;
+}
+
+// Sets the move settle window
+void PID::setMoveSettle(double errorWindow, double velocityWindow, int dwellTime) {
+  PID::moveSettler.setSettleWindow(errorWindow, velocityWindow, dwellTime);
+}
+
+// Sets the move stall detection window
+void PID::setMoveStall(double stallVelocity, double stallPower, int stallTime) {
+  PID::moveSettler.setStallWindow(stallVelocity, stallPower, stallTime);
+}
+
+// Sets the strafe settle window
+void PID::setStrafeSettle(double errorWindow, double velocityWindow, int dwellTime) {
+  PID::strafeSettler.setSettleWindow(errorWindow, velocityWindow, dwellTime);
+}
+
+// Sets the strafe stall detection window
+void PID::setStrafeStall(double stallVelocity, double stallPower, int stallTime) {
+  PID::strafeSettler.setStallWindow(stallVelocity, stallPower, stallTime);
+}
+
+// Sets the pivot settle window
+void PID::setPivotSettle(double errorWindow, double velocityWindow, int dwellTime) {
+  PID::pivotSettler.setSettleWindow(errorWindow, velocityWindow, dwellTime);
+}
+
+// Sets the pivot stall detection window
+void PID::setPivotStall(double stallVelocity, double stallPower, int stallTime) {
+  PID::pivotSettler.setStallWindow(stallVelocity, stallPower, stallTime);
+}
+
+// Returns whether the last motion ended by stalling rather than reaching its target
+bool PID::isStalled() {
+  return PID::lastStalled;
+}
+
+// Returns whether the last motion ran out of time before reaching its target
+bool PID::isTimedOut() {
+  return PID::lastTimedOut;
+}
+
+// Returns how long the last motion took to settle
+int PID::getSettleTime() {
+  return PID::lastSettleTime;
+}
+
+// Returns how far the last motion went past its target
+double PID::getOvershoot() {
+  return PID::lastOvershoot;
+}
+
+// Sets a function called at the end of every motion with its name and final error
+void PID::setMotionCallback(void (* callback)(std::string name, double error)) {
+  PID::motionCallback = callback;
+}
+
 // Resets the motor encoders
 void PID::resetEncoders() {
   frontLeftDrive->tare_position();
@@ -109,12 +257,23 @@ void PID::resetEncoders() {
   backRightDrive->tare_position();
 }
 
+// Returns the power needed to hold the given velocity and acceleration using the feedforward constants
+double PID::feedforward(double velocity, double acceleration) {
+  double direction = velocity < 0 ? -1 : 1;
+  double voltage = feedforwardkS * direction + feedforwardkV * velocity + feedforwardkA * acceleration;
+  // Convert the volts the drive was characterized in to the motor power commanding them at the current battery voltage
+  return util::voltageToPower(voltage * 1000.0, util::getBattery());
+}
+
 // Powers the drive motors based on the given powers
 void PID::powerDrive(int powerLeft, int powerRight) {
-  frontLeftDrive->move(powerLeft);
-  backLeftDrive->move(powerLeft);
-  frontRightDrive->move(powerRight);
-  backRightDrive->move(powerRight);
+  TIME_SCOPE(E_TIMING_MOTOR_WRITE);
+  // Sample the battery once for every motor in this cycle
+  double battery = util::sampleBattery();
+  commandMotor(frontLeftDrive, powerLeft, battery);
+  commandMotor(backLeftDrive, powerLeft, battery);
+  commandMotor(frontRightDrive, powerRight, battery);
+  commandMotor(backRightDrive, powerRight, battery);
 }
 
 // Ensures the robot drives straight using velocity PID
@@ -129,12 +288,15 @@ void PID::driveStraight(int power) {
   double derivative = 0;
 
   // If the gyro is being used, the error will simply be the gyro deviation
+  TIME_START(E_TIMING_SENSOR_READ);
   if (PID::velocityGyro)
     error = PID::velocityGyro->getHeading() - PID::velocityGyroValue;
   else
     error = backLeftDrive->get_position() - backRightDrive->get_position();
+  TIME_STOP(E_TIMING_SENSOR_READ);
 
   // Determine how much to adjust based on the kp ki and kd values
+  TIME_START(E_TIMING_PID_COMPUTE);
   derivative = error - velocityle;
   velocityse += error;
   double adjust = (error * kp) + (velocityse * ki) + (derivative * kd);
@@ -156,6 +318,7 @@ void PID::driveStraight(int power) {
 
   // Set the last error to the current error
   velocityle = error;
+  TIME_STOP(E_TIMING_PID_COMPUTE);
 
   // Log it to the message holder if the flag is set
   if (logPIDErrors)
@@ -170,21 +333,21 @@ void PID::strafeStraight(int strafePower, int movePower) {
   double kp = strafevkp;
   double ki = strafevki;
   double kd = strafevkd;
-  int powerFrontLeft = movePower + strafePower;
-  int powerFrontRight = movePower - strafePower;
-  int powerBackLeft = movePower - strafePower;
-  int powerBackRight = movePower + strafePower;
+  kinematics::WheelPowers powers = kinematics::inverse(movePower, strafePower, 0);
 
   double error = 0;
   double derivative = 0;
 
   // If the gyro is being used, the error will simply be the gyro deviation
+  TIME_START(E_TIMING_SENSOR_READ);
   if (PID::velocityGyro)
     error = PID::velocityGyro->getHeading() - PID::velocityGyroValue;
   else
     error = backLeftDrive->get_position() - backRightDrive->get_position();
+  TIME_STOP(E_TIMING_SENSOR_READ);
 
   // Determine how much to adjust based on the kp and kd values
+  TIME_START(E_TIMING_PID_COMPUTE);
   derivative = error - strafevle;
   strafevse += error;
   double adjust = (error * kp) + (strafevse * ki) + (derivative * kd);
@@ -192,24 +355,28 @@ void PID::strafeStraight(int strafePower, int movePower) {
   // Reduce the power to the faster moving side, accounting for forwards and backwards movement
   if (strafePower > 0)
     if (adjust > 0) {
-      powerFrontLeft -= adjust;
-      powerBackLeft -= adjust;
+      powers.frontLeft -= adjust;
+      powers.backLeft -= adjust;
     } else if (adjust < 0) {
-      powerFrontRight += adjust;
-      powerBackRight += adjust;
+      powers.frontRight += adjust;
+      powers.backRight += adjust;
     } else;
   else if (strafePower < 0)
     if (adjust > 0) {
-      powerFrontRight += adjust;
-      powerBackRight += adjust;
+      powers.frontRight += adjust;
+      powers.backRight += adjust;
     } else if (adjust < 0) {
-      powerFrontLeft -= adjust;
-      powerBackLeft -= adjust;
+      powers.frontLeft -= adjust;
+      powers.backLeft -= adjust;
     } else;
   else;
 
+  // Scale the powers down together if any wheel cannot reach its power
+  kinematics::desaturate(powers);
+
   // Set the last error to the current error
   strafevle = error;
+  TIME_STOP(E_TIMING_PID_COMPUTE);
 
   // Log it to the message holder if the flag is set
   if (logPIDErrors)
@@ -218,15 +385,17 @@ void PID::strafeStraight(int strafePower, int movePower) {
   LCD::setText(6, std::to_string(error));
 
 
-  // Issue the power to the motors
-  frontLeftDrive->move(powerFrontLeft);
-  frontRightDrive->move(powerFrontRight);
-  backLeftDrive->move(powerBackLeft);
-  backRightDrive->move(powerBackRight);
+  // Issue the power to the motors, sampling the battery once for every motor in this cycle
+  double battery = util::sampleBattery();
+  commandMotor(frontLeftDrive, powers.frontLeft, battery);
+  commandMotor(frontRightDrive, powers.frontRight, battery);
+  commandMotor(backLeftDrive, powers.backLeft, battery);
+  commandMotor(backRightDrive, powers.backRight, battery);
 }
 
 // Moves the robot the given amount of inches to the desired location
 void PID::move(double inches, double threshold, bool useDesiredHeading, double maxMoveTime) {
+  trace::Scope motionTrace("Move");
   double kp = movekp;
   double ki = moveki;
   double kd = movekd;
@@ -237,13 +406,27 @@ void PID::move(double inches, double threshold, bool useDesiredHeading, double m
   double lastError = 0;
   double power = minPower * util::abs(inches) / inches;
   double time = 0;
+  bool settled = false;
+  bool chained = takeChain();
 
   // Convert targetDistance from inches to degrees
   double targetDistance = inches * getGearRatio();
 
+  // If chained from a motion in the same direction, continue from its power and cover its remaining distance
+  if (chainPower * inches > 0) {
+    targetDistance += chainDistance;
+    if (util::abs(chainPower) > util::abs(power))
+      power = chainPower;
+  }
+
+  // A chained motion exits once within its exit tolerance
+  if (chained)
+    threshold = util::abs(threshold) > chainExitTolerance * getGearRatio() ? threshold : chainExitTolerance * getGearRatio();
+
   // Prepares motors for movement
   setBrakeMode();
   resetEncoders();
+  moveSettler.reset(threshold);
 
   // If gyro is used for velocity PID, prepare values
   if (velocityGyro)
@@ -274,11 +457,31 @@ void PID::move(double inches, double threshold, bool useDesiredHeading, double m
     accelDelay = PID::accelerationBackwardDelay;
   }
 
+  // With feedforward, ramp a velocity setpoint at the set acceleration instead, starting from the current power,
+  // up to the velocity the maximum power can hold
+  bool useFeedforward = feedforwardkV > 0 && feedforwardAccel > 0;
+  double velocity = 0;
+  double cruiseVelocity = 0;
+  if (useFeedforward) {
+    // Sample the battery, as this may be the first drive command since the program started
+    double battery = util::sampleBattery();
+    accelDelay = 20;
+    cruiseVelocity = (util::powerToVoltage(maxPower, battery) / 1000.0 - feedforwardkS) / feedforwardkV;
+    velocity = (util::powerToVoltage(util::abs(power), battery) / 1000.0 - feedforwardkS) / feedforwardkV;
+    if (velocity < 0)
+      velocity = 0;
+  }
+
   // Accelerate to the max speed smoothly
   while (util::abs(power) < maxPower && util::abs(power) < util::abs(kp * error)) {
     // Increase the power
-    power *= accelCoeff;
-    power = power + accelConst * util::abs(inches) / inches;
+    if (useFeedforward) {
+      velocity += feedforwardAccel * accelDelay / 1000.0;
+      power = feedforward(velocity * util::abs(inches) / inches, feedforwardAccel * util::abs(inches) / inches);
+    } else {
+      power *= accelCoeff;
+      power = power + accelConst * util::abs(inches) / inches;
+    }
     driveStraight(power);
 
     // Repeat with the set delay
@@ -286,21 +489,38 @@ void PID::move(double inches, double threshold, bool useDesiredHeading, double m
     time += accelDelay/1000.0;
 
     // Update the error and current distance
+    TIME_START(E_TIMING_SENSOR_READ);
     currentDistance = (backRightDrive->get_position() + backLeftDrive->get_position()) / 2;
     error = targetDistance - currentDistance;
+    TIME_STOP(E_TIMING_SENSOR_READ);
     lastError = error;
   }
 
-  // Enter the main PID loop
-  while (continuePIDLoop(util::abs(error) >= threshold) && time < maxMoveTime) {
+  // Enter the main PID loop, until the robot settles or stalls, or is within the threshold if chained or not settling
+  while (continuePIDLoop(!settled && (util::abs(error) >= threshold || (!chained && moveSettler.settles()))) && time < maxMoveTime) {
     // Calculate the integral derivative term and store the current error
+    TIME_START(E_TIMING_PID_COMPUTE);
     derivative = error - lastError;
     errorsum += error;
     lastError = error;
 
     // Determine power and checks if power is within constraints
     power = (error * kp) + (derivative * kd);
+
+    // With feedforward, add the power to hold the velocity of a profile cruising at the maximum power, then
+    // decelerating at the set acceleration to stop at the target. The PID corrects for where the profile is wrong
+    if (useFeedforward) {
+      double direction = error < 0 ? -1 : 1;
+      double profileVelocity = std::sqrt(2 * feedforwardAccel * util::abs(error) / getGearRatio());
+      double profileAccel = -feedforwardAccel;
+      if (profileVelocity >= cruiseVelocity) {
+        profileVelocity = cruiseVelocity;
+        profileAccel = 0;
+      }
+      power += feedforward(direction * profileVelocity, direction * profileAccel);
+    }
     power = checkPower(power);
+    TIME_STOP(E_TIMING_PID_COMPUTE);
 
     // Passes the requested power to the velocity PID
     driveStraight(power);
@@ -314,16 +534,22 @@ void PID::move(double inches, double threshold, bool useDesiredHeading, double m
     time += 0.02;
 
     // Update the error and current distance
+    TIME_START(E_TIMING_SENSOR_READ);
     currentDistance = (backRightDrive->get_position() + backLeftDrive->get_position()) / 2;
     error = targetDistance - currentDistance;
+    TIME_STOP(E_TIMING_SENSOR_READ);
+
+    // Check whether the robot has settled or stalled
+    settled = moveSettler.update(error, power);
 
     // Log it to the message holder if the flag is set
     if (logPIDErrors)
       messageHolder->appendLine("Move Err: " + std::to_string(error));
   }
 
-  // Stop the motors and exit
-  powerDrive(0, 0);
+  // Stop the motors, or hand off to the next motion, and exit
+  endMotion(chained, inches, error);
+  finishMotion(moveSettler, "Move", error / getGearRatio(), time >= maxMoveTime);
 }
 void PID::move(double inches, bool useDesiredHeading) {
   PID::move(inches, 8, useDesiredHeading);
@@ -331,16 +557,28 @@ void PID::move(double inches, bool useDesiredHeading) {
 
 // Moves the robot the given amount of inches while only using velocity PID
 void PID::velocityMove(double inches, double power, double threshold, bool useDesiredHeading, double maxMoveTime) {
+  trace::Scope motionTrace("VMove");
   double currentDistance = 0;
   double error = 0;
   double time = 0;
+  bool settled = false;
+  bool chained = takeChain();
 
   // Convert the inches to degrees
   double targetDistance = inches * pid->getGearRatio();
 
+  // If chained from a motion in the same direction, cover its remaining distance
+  if (chainPower * inches > 0)
+    targetDistance += chainDistance;
+
+  // A chained motion exits once within its exit tolerance
+  if (chained)
+    threshold = util::abs(threshold) > chainExitTolerance * getGearRatio() ? threshold : chainExitTolerance * getGearRatio();
+
   // Prepares motors for movement
   setBrakeMode();
   resetEncoders();
+  moveSettler.reset(threshold);
 
   // If gyro is used for velocity PID, prepare values
   if (velocityGyro)
@@ -355,8 +593,9 @@ void PID::velocityMove(double inches, double power, double threshold, bool useDe
   // Set the current error
   error = targetDistance - currentDistance;
 
-  // While the target has not been reached, power the drive
-  while (continuePIDLoop(util::abs(error) >= threshold) && time < maxMoveTime) {
+  // While the target has not been reached, power the drive. The power is fixed, so the robot never slows to settle
+  // and the motion ends at the threshold or once it stalls
+  while (continuePIDLoop(util::abs(error) >= threshold && !settled) && time < maxMoveTime) {
     driveStraight(power * util::abs(error) / error);
 
     // Print the sensor debug information
@@ -367,16 +606,22 @@ void PID::velocityMove(double inches, double power, double threshold, bool useDe
     time += 0.02;
 
     // Update the error and current distance
+    TIME_START(E_TIMING_SENSOR_READ);
     currentDistance = (backRightDrive->get_position() + backLeftDrive->get_position()) / 2;
     error = targetDistance - currentDistance;
+    TIME_STOP(E_TIMING_SENSOR_READ);
+
+    // Check whether the robot has settled or stalled
+    settled = moveSettler.update(error, power);
 
     // Log it to the message holder if the flag is set
     if (logPIDErrors)
       messageHolder->appendLine("VMove Err: " + std::to_string(error));
   }
 
-  // Stop the motors and exit
-  powerDrive(0, 0);
+  // Stop the motors, or hand off to the next motion, and exit
+  endMotion(chained, inches, error);
+  finishMotion(moveSettler, "VMove", error / getGearRatio(), time >= maxMoveTime);
 }
 void PID::velocityMove(double inches, double power, bool useDesiredHeading) {
   PID::velocityMove(inches, power, 12, useDesiredHeading);
@@ -384,6 +629,7 @@ void PID::velocityMove(double inches, double power, bool useDesiredHeading) {
 
 // Moves the robot with custom left and right targets while only using positional PID
 void PID::customMove(double leftInches, double rightInches, double threshold) {
+  trace::Scope motionTrace("CMove");
   double kp = movekp;
   double ki = moveki;
   double kd = movekd;
@@ -393,14 +639,18 @@ void PID::customMove(double leftInches, double rightInches, double threshold) {
   double rightErrorSum = 0;
   double leftDerivative = 0;
   double rightDerivative = 0;
+  double time = 0;
+  bool settled = false;
 
   // Convert the inches to degrees
   double leftTargetDistance = leftInches * getGearRatio();
   double rightTargetDistance = rightInches * getGearRatio();
 
-  // Prepares motors for movement
+  // Prepares motors for movement, with a settle detector for each side configured as the move settle detector
   setBrakeMode();
   resetEncoders();
+  moveSettler.reset(threshold);
+  SettleDetector rightSettler = moveSettler;
 
   // Set the current error
   double leftError = leftTargetDistance - leftCurrentDistance;
@@ -408,9 +658,10 @@ void PID::customMove(double leftInches, double rightInches, double threshold) {
   double lastLeftError = leftTargetDistance;
   double lastRightError = rightTargetDistance;
 
-  // While the target has not been reached, power the drive
-  while (continuePIDLoop(util::abs(leftError) >= threshold || util::abs(rightError) >= threshold)) {
+  // Power the drive until both sides settle or either stalls, or both are within the threshold if not settling
+  while (continuePIDLoop(!settled && (util::abs(leftError) >= threshold || util::abs(rightError) >= threshold || moveSettler.settles())) && time < PID::maxMoveTime) {
     // Calculate the derivative term
+    TIME_START(E_TIMING_PID_COMPUTE);
     leftDerivative = leftError - lastLeftError;
     rightDerivative = rightError - lastRightError;
 
@@ -427,6 +678,7 @@ void PID::customMove(double leftInches, double rightInches, double threshold) {
     double rightPower = (rightError * kp) + (rightErrorSum + ki) + (rightDerivative * kd);
     leftPower = checkPower(leftPower);
     rightPower = checkPower(rightPower);
+    TIME_STOP(E_TIMING_PID_COMPUTE);
 
     // Passes the requested power to the motors
     powerDrive(leftPower, rightPower);
@@ -436,12 +688,20 @@ void PID::customMove(double leftInches, double rightInches, double threshold) {
 
     // Run every 20 ms
     pros::delay(20);
+    time += 0.02;
 
     // Update the error and current distance
+    TIME_START(E_TIMING_SENSOR_READ);
     leftCurrentDistance = (frontLeftDrive->get_position() + backLeftDrive->get_position()) / 2;
     rightCurrentDistance = (frontRightDrive->get_position() + backRightDrive->get_position()) / 2;
     leftError = leftTargetDistance - leftCurrentDistance;
     rightError = rightTargetDistance - rightCurrentDistance;
+    TIME_STOP(E_TIMING_SENSOR_READ);
+
+    // Check whether both sides have settled or either has stalled
+    bool leftDone = moveSettler.update(leftError, leftPower);
+    bool rightDone = rightSettler.update(rightError, rightPower);
+    settled = (leftDone && rightDone) || moveSettler.isStalled() || rightSettler.isStalled();
 
     // Log it to the message holder if the flag is set
     if (logPIDErrors)
@@ -449,11 +709,13 @@ void PID::customMove(double leftInches, double rightInches, double threshold) {
   }
 
   // Stop the motors and exit
-  powerDrive(0, 0);
+  endMotion(false, 0, 0);
+  finishMotion(rightSettler.isStalled() ? rightSettler : moveSettler, "CMove", (util::abs(leftError) > util::abs(rightError) ? leftError : rightError) / getGearRatio(), time >= PID::maxMoveTime);
 }
 
 // Strafes the robot the given amount of inches to the desired position
 void PID::strafe(double inches, double threshold, bool useDesiredHeading) {
+  trace::Scope motionTrace("Strafe");
   double kp = strafekp;
   double ki = strafeki;
   double kd = strafekd;
@@ -463,6 +725,8 @@ void PID::strafe(double inches, double threshold, bool useDesiredHeading) {
   double derivative = 0;
   double lastError = 0;
   double power = minPower * util::abs(inches) / inches;
+  double time = 0;
+  bool settled = false;
 
   // Convert targetDistance from inches to degrees
   double targetDistance = inches * strafeInchAmount;
@@ -470,6 +734,7 @@ void PID::strafe(double inches, double threshold, bool useDesiredHeading) {
   // Prepares motors for movement
   setBrakeMode();
   resetEncoders();
+  strafeSettler.reset(threshold);
 
   // If gyro is used for velocity PID, prepare values
   if (velocityGyro)
@@ -484,9 +749,10 @@ void PID::strafe(double inches, double threshold, bool useDesiredHeading) {
   // Set the current error
   error = targetDistance - currentDistance;
 
-  // Enter the main PID loop
-  while (continuePIDLoop(util::abs(error) >= threshold)) {
+  // Enter the main PID loop, until the robot settles or stalls, or is within the threshold if not settling
+  while (continuePIDLoop(!settled && (util::abs(error) >= threshold || strafeSettler.settles())) && time < PID::maxMoveTime) {
     // Calculate the integral and derivative term and store the current error
+    TIME_START(E_TIMING_PID_COMPUTE);
     derivative = error - lastError;
     errorsum += error;
     lastError = error;
@@ -494,6 +760,7 @@ void PID::strafe(double inches, double threshold, bool useDesiredHeading) {
     // Determine power and checks if power is within constraints
     power = (error * kp) + (errorsum * ki) + (derivative * kd);
     power = checkPower(power);
+    TIME_STOP(E_TIMING_PID_COMPUTE);
 
     // Passes the requested power to the velocity PID
     strafeStraight(power * util::abs(error) / error);
@@ -503,10 +770,16 @@ void PID::strafe(double inches, double threshold, bool useDesiredHeading) {
 
     // Run every 20 ms
     pros::delay(20);
+    time += 0.02;
 
     // Update the error and current distance
+    TIME_START(E_TIMING_SENSOR_READ);
     currentDistance = (backRightDrive->get_position() - backLeftDrive->get_position()) / 2;
     error = targetDistance - currentDistance;
+    TIME_STOP(E_TIMING_SENSOR_READ);
+
+    // Check whether the robot has settled or stalled
+    settled = strafeSettler.update(error, power);
 
     // Log it to the message holder if the flag is set
     if (logPIDErrors)
@@ -514,7 +787,8 @@ void PID::strafe(double inches, double threshold, bool useDesiredHeading) {
   }
 
   // Stop the motors and exit
-  powerDrive(0, 0);
+  endMotion(false, 0, 0);
+  finishMotion(strafeSettler, "Strafe", error / getGearRatio(), time >= PID::maxMoveTime);
 }
 
 // Pivots the robot relative the given amount of degrees, based on the current desired heading
@@ -531,6 +805,7 @@ void PID::pivotRelative(double degrees, double threshold, bool modifyDesiredHead
 
 // Pivots the robot to the heading given
 void PID::pivotAbsolute(double heading, double threshold, bool modifyDesiredHeading) {
+  trace::Scope motionTrace("Pivot");
   double kp = pivotkp;
   double ki = pivotki;
   double kd = pivotkd;
@@ -540,15 +815,25 @@ void PID::pivotAbsolute(double heading, double threshold, bool modifyDesiredHead
   double derivative = 0;
   double lastError = 0;
   int power = 0;
+  double time = 0;
+  bool settled = false;
+  double chainDirection = chainNextDirection;
+  bool chained = takeChain();
+
+  // A chained motion exits once within its exit tolerance
+  if (chained)
+    threshold = util::abs(threshold) > chainExitTolerance ? threshold : chainExitTolerance;
 
   // Converts targetBearing to a 10th of a degree
   double targetBearing = heading;
 
   // Calculate the error before the loop
   error = targetBearing - currentBearing;
+  pivotSettler.reset(threshold);
 
-  while (continuePIDLoop(util::abs(error) >= threshold)) {
+  while (continuePIDLoop(!settled && (util::abs(error) >= threshold || (!chained && pivotSettler.settles()))) && time < PID::maxMoveTime) {
     // Calculate the integral and derivative term and store the current error
+    TIME_START(E_TIMING_PID_COMPUTE);
     derivative = error - lastError;
     if (util::abs(error) < 90.5) // Only activate integral when the error is less than 90 degrees
       errorsum += error;
@@ -557,6 +842,7 @@ void PID::pivotAbsolute(double heading, double threshold, bool modifyDesiredHead
     // Determines power and checks if power is within constraints
     power = (error * kp) + (errorsum * ki) + (derivative  * kd);
     power = checkPower(power);
+    TIME_STOP(E_TIMING_PID_COMPUTE);
 
     // Passes the requested power to the motors
     powerDrive(power, -power);
@@ -566,13 +852,19 @@ void PID::pivotAbsolute(double heading, double threshold, bool modifyDesiredHead
 
     // Run every 20 ms
     pros::delay(20);
+    time += 0.02;
 
     // Update the error and current bearing
+    TIME_START(E_TIMING_SENSOR_READ);
     currentBearing = ports::gyro->getHeading();
     error = targetBearing - currentBearing;
+    TIME_STOP(E_TIMING_SENSOR_READ);
 
     if (abs(error) < 3) errorsum = 0;
 
+    // Check whether the robot has settled or stalled
+    settled = pivotSettler.update(error, power);
+
     // Log it to the message holder if the flag is set
     if (logPIDErrors)
       messageHolder->appendLine("Pivot Err: " + std::to_string(error));
@@ -582,8 +874,9 @@ void PID::pivotAbsolute(double heading, double threshold, bool modifyDesiredHead
   if (modifyDesiredHeading)
     PID::desiredHeading = heading;
 
-  // Stop the motors and exit
-  powerDrive(0, 0);
+  // Stop the motors, or hand off in the direction of the move following the pivot, and exit
+  endMotion(chained, chainDirection, 0);
+  finishMotion(pivotSettler, "Pivot", error, time >= PID::maxMoveTime);
 }
 
 // Sets the desired heading to the current heading
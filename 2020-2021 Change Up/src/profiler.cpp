@@ -0,0 +1,161 @@
+#include "main.h"
+#include <cstdio>
+#include <cstring>
+
+// Task state provided by the kernel, matching FreeRTOS' TaskStatus_t as the kernel configures it: with run time
+// statistics kept in 32 bit counters and a 16 bit stack high water mark, so nine 4 byte fields on the brain
+struct TaskStatus {
+  void * handle;
+  const char * name;
+  unsigned long number;
+  int state;
+  unsigned long priority;
+  unsigned long basePriority;
+  std::uint32_t runTime;
+  void * stackBase;
+  std::uint16_t stackHighWaterMark; // in words
+};
+#ifdef __arm__
+static_assert(sizeof(TaskStatus) == 36, "TaskStatus must match the kernel's TaskStatus_t");
+#endif
+extern "C" unsigned long uxTaskGetSystemState(TaskStatus * statuses, unsigned long size, std::uint32_t * totalRunTime);
+
+// Task to be given to the global TaskProfiler object
+void profilerTask(void * param) {
+  ports::profiler->task();
+}
+
+// Task sampling every task
+void TaskProfiler::task() {
+  std::uint32_t wake = pros::millis();
+
+  while (true) {
+    TaskProfiler::sample();
+    pros::Task::delay_until(&wake, SAMPLE_PERIOD);
+  }
+}
+
+// Create the default constructor
+TaskProfiler::TaskProfiler() = default;
+
+// Samples every task, updating the profiles
+void TaskProfiler::sample() {
+  trace::Scope sampleTrace("Profiler sample");
+  static TaskStatus statuses[MAX_TASKS];
+  static void * lastHandles[MAX_TASKS];
+  static std::uint32_t lastRunTimes[MAX_TASKS];
+  static double lastMaxCpu[MAX_TASKS];
+  static bool lastOverrun[MAX_TASKS];
+  // Whether each task has just been flagged, so it is only written once per overrun
+  static bool flagged[MAX_TASKS];
+  std::uint32_t totalRunTime = 0;
+
+  // The kernel lists no tasks if there are more than there is room for, so keep the last profiles and say so once
+  int tasks = pros::c::task_get_count();
+  if (tasks > MAX_TASKS) {
+    if (!tooMany) {
+      char line[64];
+      std::snprintf(line, sizeof(line), "Profiler: %d tasks, only %d can be profiled", tasks, MAX_TASKS);
+      ports::messageHolder->appendLine(line);
+      LCD::setText(8, line);
+      tooMany = true;
+    }
+    return;
+  }
+  int found = uxTaskGetSystemState(statuses, MAX_TASKS, &totalRunTime);
+  std::uint32_t elapsed = totalRunTime - lastTotalRunTime;
+
+  // Keep the last sample, as tasks may not be listed in the same order
+  int lastCount = count;
+  for (int i = 0; i < lastCount; i++) {
+    lastHandles[i] = handles[i];
+    lastRunTimes[i] = lastRunTime[i];
+    lastMaxCpu[i] = profiles[i].maxCpu;
+    lastOverrun[i] = profiles[i].overrun;
+  }
+
+  bool overrun = false;
+  int busiest = -1;
+  int tightest = -1;
+  for (int i = 0; i < found; i++) {
+    const TaskStatus & status = statuses[i];
+    TaskProfile & profile = profiles[i];
+
+    // Carry over the run time counter and highest share if the task was profiled last sample
+    int last = -1;
+    for (int j = 0; j < lastCount && last < 0; j++)
+      if (lastHandles[j] == status.handle)
+        last = j;
+    double maxCpu = last >= 0 ? lastMaxCpu[last] : 0;
+    std::uint32_t lastRun = last >= 0 ? lastRunTimes[last] : status.runTime;
+
+    std::strncpy(profile.name, status.name, sizeof(profile.name) - 1);
+    profile.name[sizeof(profile.name) - 1] = '\0';
+    profile.priority = status.priority;
+    profile.cpu = elapsed > 0 ? 100.0 * (status.runTime - lastRun) / elapsed : 0;
+    profile.maxCpu = profile.cpu > maxCpu ? profile.cpu : maxCpu;
+    profile.stackFree = status.stackHighWaterMark * sizeof(std::uint32_t);
+    // The idle task is expected to be busy, so is only flagged for its stack
+    bool idle = std::strcmp(profile.name, "IDLE") == 0;
+    profile.overrun = (!idle && profile.cpu > cpuLimit) || profile.stackFree < stackLimit;
+    flagged[i] = profile.overrun && !(last >= 0 && lastOverrun[last]);
+    handles[i] = status.handle;
+    lastRunTime[i] = status.runTime;
+
+    if (!idle && (busiest < 0 || profile.cpu > profiles[busiest].cpu))
+      busiest = i;
+    if (tightest < 0 || profile.stackFree < profiles[tightest].stackFree)
+      tightest = i;
+    overrun = overrun || profile.overrun;
+  }
+  count = found;
+  lastTotalRunTime = totalRunTime;
+
+  // Show the busiest task and the task closest to overflowing its stack
+  if (busiest >= 0 && tightest >= 0) {
+    char line[64];
+    std::snprintf(line, sizeof(line), "%sCPU: %s %.0f%%, stack: %s %d B", overrun ? "OVERRUN " : "", profiles[busiest].name, profiles[busiest].cpu, profiles[tightest].name, profiles[tightest].stackFree);
+    LCD::setText(8, line);
+  }
+
+  // Write each task's profile if reporting, and any task which has just been flagged regardless
+  for (int i = 0; i < found; i++) {
+    const TaskProfile & profile = profiles[i];
+    if (!reporting && !flagged[i])
+      continue;
+    char line[96];
+    std::snprintf(line, sizeof(line), "Task %s: cpu %.1f%% (max %.1f%%), stack %d B free, priority %d%s", profile.name, profile.cpu, profile.maxCpu, profile.stackFree, profile.priority, profile.overrun ? " OVERRUN" : "");
+    ports::messageHolder->appendLine(line);
+  }
+}
+
+// Sets the limits a task is flagged at
+void TaskProfiler::setLimits(double cpuLimit, int stackLimit) {
+  TaskProfiler::cpuLimit = cpuLimit;
+  TaskProfiler::stackLimit = stackLimit;
+}
+
+// Sets whether to write each task's profile to the message holder every sample
+void TaskProfiler::setReporting(bool flag) {
+  TaskProfiler::reporting = flag;
+}
+
+// Returns the amount of tasks profiled
+int TaskProfiler::getTaskCount() {
+  return count;
+}
+
+// Returns the profile of the task at the given index
+TaskProfile TaskProfiler::getProfile(int index) {
+  if (index < 0 || index >= count)
+    return TaskProfile();
+  return profiles[index];
+}
+
+// Returns whether any task was flagged in the last sample
+bool TaskProfiler::isOverrun() {
+  for (int i = 0; i < count; i++)
+    if (profiles[i].overrun)
+      return true;
+  return false;
+}
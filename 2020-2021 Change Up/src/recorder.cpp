@@ -0,0 +1,216 @@
+#include "main.h"
+#include <cstdio>
+
+// Dump ports namespace for ease of use
+using namespace ports;
+
+// Create the default constructor
+DriveRecorder::DriveRecorder() = default;
+
+// Returns the average position of the drive motors, in degrees
+double DriveRecorder::drivePosition() {
+  return (frontLeftDrive->get_position() + backLeftDrive->get_position() + frontRightDrive->get_position() + backRightDrive->get_position()) / 4;
+}
+
+// Appends a value of the given amount of bytes, returning false if the buffer is full
+bool DriveRecorder::write(std::int32_t value, int bytes) {
+  if (length + bytes > BUFFER_SIZE)
+    return false;
+  for (int i = 0; i < bytes; i++)
+    buffer[length++] = (value >> (8 * i)) & 0xFF;
+  return true;
+}
+
+// Reads a value of the given amount of bytes
+std::int32_t DriveRecorder::read(int bytes) {
+  std::uint32_t value = 0;
+  for (int i = 0; i < bytes && cursor < length; i++)
+    value |= (std::uint32_t) buffer[cursor++] << (8 * i);
+  return value;
+}
+
+// Starts a new recording, saving the operator control state
+void DriveRecorder::startRecording() {
+  replaying = false;
+  length = 0;
+  frames = 0;
+  for (int a = 0; a < 4; a++)
+    lastAnalog[a] = 0;
+  lastButtons = 0;
+  startHeading = gyro->getCachedHeading();
+  startPosition = drivePosition();
+  startFieldCentric = fieldCentric;
+  startFieldCentricZero = fieldCentricZero - startHeading;
+  startDriver = selectedDriver;
+  recording = true;
+}
+
+// Stops the recording
+void DriveRecorder::stopRecording() {
+  recording = false;
+}
+
+// Returns whether a recording is in progress
+bool DriveRecorder::isRecording() {
+  return recording;
+}
+
+// Starts replaying the recording from the beginning, restoring the operator control state it started with
+void DriveRecorder::startReplay() {
+  recording = false;
+  cursor = 0;
+  frames = 0;
+  for (int a = 0; a < 4; a++)
+    lastAnalog[a] = 0;
+  lastButtons = 0;
+  startHeading = gyro->getCachedHeading();
+  startPosition = drivePosition();
+  targetHeading = startHeading;
+  targetPosition = startPosition;
+  moveCorrection = 0;
+  turnCorrection = 0;
+  fieldCentric = startFieldCentric;
+  fieldCentricZero = startHeading + startFieldCentricZero;
+  selectedDriver = startDriver >= 0 && startDriver < driverProfileCount ? startDriver : 0;
+  replaying = true;
+}
+
+// Stops replaying the recording
+void DriveRecorder::stopReplay() {
+  replaying = false;
+  moveCorrection = 0;
+  turnCorrection = 0;
+}
+
+// Returns whether a recording is being replayed
+bool DriveRecorder::isReplaying() {
+  return replaying;
+}
+
+// Records a frame of stick values and button states
+void DriveRecorder::record(const volatile int analog[4], int buttons) {
+  if (!recording)
+    return;
+
+  // Flag what has changed since the last frame
+  bool keyframe = frames % KEYFRAME_INTERVAL == 0;
+  int header = keyframe ? 1 << 5 : 0;
+  for (int a = 0; a < 4; a++)
+    if (analog[a] != lastAnalog[a])
+      header |= 1 << a;
+  if (buttons != lastButtons)
+    header |= 1 << 4;
+
+  // Write the header followed by only the changed values
+  int frameStart = length;
+  bool written = write(header, 1);
+  for (int a = 0; a < 4; a++)
+    if (header & (1 << a)) {
+      written = written && write(analog[a], 1);
+      lastAnalog[a] = analog[a];
+    }
+  if (header & (1 << 4)) {
+    written = written && write(buttons, 2);
+    lastButtons = buttons;
+  }
+  if (keyframe) {
+    written = written && write((gyro->getCachedHeading() - startHeading) * 100, 4);
+    written = written && write(drivePosition() - startPosition, 4);
+  }
+
+  // Stop once the buffer is full, keeping the whole frames recorded and dropping this partly written one
+  if (!written) {
+    length = frameStart;
+    recording = false;
+    return;
+  }
+  frames++;
+}
+
+// Reads the next frame of stick values and button states, returning false once the recording has ended
+bool DriveRecorder::playback(int analog[4], int & buttons) {
+  if (!replaying || cursor >= length) {
+    stopReplay();
+    return false;
+  }
+
+  // Apply the changed values over the last frame
+  int header = read(1);
+  for (int a = 0; a < 4; a++)
+    if (header & (1 << a))
+      lastAnalog[a] = (std::int8_t) read(1);
+  if (header & (1 << 4))
+    lastButtons = read(2);
+
+  // At a keyframe, calculate the corrections towards where the robot was when recording
+  if (header & (1 << 5)) {
+    targetHeading = startHeading + read(4) / 100.0;
+    targetPosition = startPosition + read(4);
+    turnCorrection = HEADING_KP * (targetHeading - gyro->getCachedHeading());
+    moveCorrection = POSITION_KP * (targetPosition - drivePosition());
+    if (util::abs(turnCorrection) > MAX_CORRECTION)
+      turnCorrection = turnCorrection < 0 ? -MAX_CORRECTION : MAX_CORRECTION;
+    if (util::abs(moveCorrection) > MAX_CORRECTION)
+      moveCorrection = moveCorrection < 0 ? -MAX_CORRECTION : MAX_CORRECTION;
+  }
+
+  for (int a = 0; a < 4; a++)
+    analog[a] = lastAnalog[a];
+  buttons = lastButtons;
+  frames++;
+  return true;
+}
+
+// Returns the power to add to forward movement to steer back towards the recording
+double DriveRecorder::getMoveCorrection() {
+  return replaying ? moveCorrection : 0;
+}
+
+// Returns the power to add to turning to steer back towards the recording
+double DriveRecorder::getTurnCorrection() {
+  return replaying ? turnCorrection : 0;
+}
+
+// Returns the heading the robot had at the last keyframe replayed
+double DriveRecorder::getCorrectionHeading() {
+  return targetHeading;
+}
+
+// Writes the recording to the given file, returning whether it was successful
+bool DriveRecorder::save(std::string path) {
+  FILE * file = fopen(path.c_str(), "wb");
+  if (file == NULL)
+    return false;
+
+  // Write a header identifying the format, the operator control state and the length, followed by the recording
+  std::int32_t size = length;
+  std::int32_t state[3] = {startFieldCentric, (std::int32_t) (startFieldCentricZero * 100), startDriver};
+  fwrite("DRV2", 1, 4, file);
+  fwrite(state, sizeof(state), 1, file);
+  fwrite(&size, sizeof(size), 1, file);
+  fwrite(buffer, 1, length, file);
+  fclose(file);
+  return true;
+}
+
+// Reads a recording from the given file, returning whether it was successful
+bool DriveRecorder::load(std::string path) {
+  FILE * file = fopen(path.c_str(), "rb");
+  if (file == NULL)
+    return false;
+
+  char magic[4] = {};
+  std::int32_t state[3] = {};
+  std::int32_t size = 0;
+  bool valid = fread(magic, 1, 4, file) == 4 && magic[0] == 'D' && magic[1] == 'R' && magic[2] == 'V' && magic[3] == '2';
+  valid = valid && fread(state, sizeof(state), 1, file) == 1;
+  valid = valid && fread(&size, sizeof(size), 1, file) == 1 && size >= 0 && size <= BUFFER_SIZE;
+  valid = valid && (int) fread(buffer, 1, size, file) == size;
+  fclose(file);
+
+  length = valid ? size : 0;
+  startFieldCentric = valid && state[0];
+  startFieldCentricZero = valid ? state[1] / 100.0 : 0;
+  startDriver = valid ? state[2] : 0;
+  return valid;
+}
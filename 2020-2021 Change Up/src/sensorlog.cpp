@@ -0,0 +1,128 @@
+#include "main.h"
+#include <atomic>
+#include <cstdio>
+
+namespace sensorlog {
+
+  // Recorded values, with the count claimed atomically as records can come from several tasks
+  Record records[MAX_RECORDS];
+  std::atomic<int> count(0);
+  volatile bool logging = false;
+  int autonomous = 0;
+
+  // The tasks records are tagged against
+  pros::task_t loggedTask = NULL;
+  pros::task_t gyroTask = NULL;
+
+  // Starts a new log from the calling task, storing the autonomous being run
+  void start(int autonomous) {
+    logging = false;
+    sensorlog::autonomous = autonomous;
+    loggedTask = pros::c::task_get_current();
+    gyroTask = ports::gyroTask == NULL ? NULL : (pros::task_t) *ports::gyroTask;
+    count = 0;
+    logging = true;
+  }
+
+  // Stops logging
+  void stop() {
+    logging = false;
+  }
+
+  // Returns whether a log is in progress
+  bool isLogging() {
+    return logging;
+  }
+
+  // Writes the log to the given file, returning whether it was successful
+  bool save(std::string path) {
+    FILE * file = fopen(path.c_str(), "wb");
+    if (file == NULL)
+      return false;
+
+    // Write a header identifying the format, the autonomous and the amount of records, followed by the records
+    std::int32_t header[2] = {autonomous, count < MAX_RECORDS ? count.load() : MAX_RECORDS};
+    fwrite("SNS1", 1, 4, file);
+    fwrite(header, sizeof(header[0]), 2, file);
+    fwrite(records, sizeof(Record), header[1], file);
+    fclose(file);
+    return true;
+  }
+
+  // Records a value read from or written to a device, returning the value
+  double record(int port, sensor_channel channel, double value) {
+    if (!logging)
+      return value;
+
+    int index = count++;
+    if (index >= MAX_RECORDS)
+      return value;
+
+    pros::task_t task = pros::c::task_get_current();
+    Record & record = records[index];
+    record.time = util::micros();
+    record.task = task == loggedTask ? TASK_LOGGED : (task == gyroTask ? TASK_GYRO : TASK_OTHER);
+    record.port = port;
+    record.channel = channel;
+    record.reserved = 0;
+    record.value = value;
+    return value;
+  }
+
+  // Returns the time since the program started, in ms, recording it if logging
+  std::uint32_t millis() {
+    return record(0, E_SENSOR_MILLIS, pros::millis());
+  }
+
+  // Returns the battery voltage, in mV, recording it if logging
+  std::int32_t battery() {
+    return record(0, E_SENSOR_BATTERY, pros::battery::get_voltage());
+  }
+
+}
+
+// Constructs the motor with the same parameters as pros::Motor
+LoggedMotor::LoggedMotor(std::uint8_t port, pros::motor_gearset_e_t gearset, bool reverse, pros::motor_encoder_units_e_t encoderUnits) : pros::Motor(port, gearset, reverse, encoderUnits) {}
+
+// Passthroughs which record to the sensor log
+std::int32_t LoggedMotor::move(std::int32_t voltage) const {
+  sensorlog::record(get_port(), sensorlog::E_SENSOR_MOVE, voltage);
+  return pros::Motor::move(voltage);
+}
+
+std::int32_t LoggedMotor::move_voltage(std::int32_t voltage) const {
+  sensorlog::record(get_port(), sensorlog::E_SENSOR_MOVE_VOLTAGE, voltage);
+  return pros::Motor::move_voltage(voltage);
+}
+
+std::int32_t LoggedMotor::move_velocity(std::int32_t velocity) const {
+  sensorlog::record(get_port(), sensorlog::E_SENSOR_MOVE_VELOCITY, velocity);
+  return pros::Motor::move_velocity(velocity);
+}
+
+std::int32_t LoggedMotor::tare_position() const {
+  sensorlog::record(get_port(), sensorlog::E_SENSOR_TARE, 0);
+  return pros::Motor::tare_position();
+}
+
+double LoggedMotor::get_position() const {
+  return sensorlog::record(get_port(), sensorlog::E_SENSOR_POSITION, pros::Motor::get_position());
+}
+
+// Constructs the sensor on the given port
+LoggedImu::LoggedImu(std::uint8_t port) : pros::Imu(port) {
+  LoggedImu::port = port;
+}
+
+// Passthroughs which record to the sensor log
+double LoggedImu::get_yaw() const {
+  return sensorlog::record(port, sensorlog::E_SENSOR_YAW, pros::Imu::get_yaw());
+}
+
+double LoggedImu::get_pitch() const {
+  return sensorlog::record(port, sensorlog::E_SENSOR_PITCH, pros::Imu::get_pitch());
+}
+
+double LoggedImu::get_roll() const {
+  return sensorlog::record(port, sensorlog::E_SENSOR_ROLL, pros::Imu::get_roll());
+}
@@ -0,0 +1,106 @@
+#include "main.h"
+
+// Create the default constructor
+SettleDetector::SettleDetector() = default;
+
+// Sets the settle window
+void SettleDetector::setSettleWindow(double errorWindow, double velocityWindow, int dwellTime) {
+  SettleDetector::errorWindow = errorWindow;
+  SettleDetector::velocityWindow = velocityWindow;
+  SettleDetector::dwellTime = dwellTime;
+}
+
+// Sets the stall detection window
+void SettleDetector::setStallWindow(double stallVelocity, double stallPower, int stallTime) {
+  SettleDetector::stallVelocity = stallVelocity;
+  SettleDetector::stallPower = stallPower;
+  SettleDetector::stallTime = stallTime;
+}
+
+// Resets the state in preparation for a new motion exiting within the given threshold
+void SettleDetector::reset(double threshold) {
+  motionErrorWindow = errorWindow > 0 && errorWindow < util::abs(threshold) ? util::abs(threshold) : errorWindow;
+  started = false;
+  settled = false;
+  stalled = false;
+  lastError = 0;
+  velocity = 0;
+  settleStart = 0;
+  stallStart = 0;
+  settleTime = -1;
+  overshoot = 0;
+}
+
+// Updates the detector with the latest error and the power being commanded, returning whether the motion is done
+bool SettleDetector::update(double error, double power) {
+  int now = util::sign(sensorlog::millis());
+
+  // The first update only records the error, as there is no rate of change yet
+  if (!started) {
+    started = true;
+    lastError = error;
+    lastUpdate = now;
+    settleStart = now;
+    stallStart = now;
+    startTime = now;
+    startError = error;
+    return false;
+  }
+
+  // Calculate the rate of change of error, ignoring updates within the same millisecond
+  if (now > lastUpdate)
+    velocity = (error - lastError) * 1000.0 / (now - lastUpdate);
+  lastError = error;
+  lastUpdate = now;
+
+  // An error of the opposite sign to the starting error is past the target
+  double past = startError < 0 ? error : -error;
+  if (past > overshoot)
+    overshoot = past;
+
+  // Restart the dwell timer whenever the motion leaves the settle window
+  if (!(motionErrorWindow > 0 && util::abs(error) <= motionErrorWindow && util::abs(velocity) <= velocityWindow))
+    settleStart = now;
+  else if (now - settleStart >= dwellTime && !settled) {
+    settled = true;
+    settleTime = settleStart - startTime;
+  }
+
+  // Restart the stall timer whenever the motion is moving or is not pushing
+  if (!(stallTime > 0 && util::abs(power) >= stallPower && util::abs(velocity) <= stallVelocity))
+    stallStart = now;
+  else if (now - stallStart >= stallTime)
+    stalled = true;
+
+  return settled || stalled;
+}
+
+// Returns whether settling is enabled
+bool SettleDetector::settles() {
+  return errorWindow > 0;
+}
+
+// Returns whether the last motion settled at its target
+bool SettleDetector::isSettled() {
+  return settled;
+}
+
+// Returns whether the last motion stalled before reaching its target
+bool SettleDetector::isStalled() {
+  return stalled;
+}
+
+// Returns the last calculated rate of change of error, in error units per second
+double SettleDetector::getVelocity() {
+  return velocity;
+}
+
+// Returns how long the last motion took to enter the settle window it settled in, or -1 if it did not settle
+int SettleDetector::getSettleTime() {
+  return settleTime;
+}
+
+// Returns how far the last motion went past its target
+double SettleDetector::getOvershoot() {
+  return overshoot;
+}
@@ -0,0 +1,108 @@
+#include "main.h"
+#include <cstdio>
+
+namespace timing {
+
+  // Buckets for times under 8 us, then four for each power of two up to 2^31 us
+  static const int BUCKET_COUNT = 8 + 29 * 4;
+
+  // The times recorded for a section
+  struct Section {
+    std::uint32_t count;
+    std::uint64_t total;
+    std::uint32_t min;
+    std::uint32_t max;
+    std::uint32_t buckets[BUCKET_COUNT];
+  };
+
+  // The table of every section, and their names
+  static Section sections[E_TIMING_SECTION_COUNT];
+  static const char * names[E_TIMING_SECTION_COUNT] = {"Sensor read", "PID compute", "Motor write", "LCD update", "Gyro update"};
+
+  // Returns the name of the section
+  std::string getName(timing_section section) {
+    return section >= 0 && section < E_TIMING_SECTION_COUNT ? names[section] : "Unknown";
+  }
+
+#if ATTACH_TIMING
+  // Returns the histogram bucket of a time
+  static int bucket(std::uint32_t time) {
+    if (time < 8)
+      return time;
+    int power = 31 - __builtin_clz(time);
+    return 8 + (power - 3) * 4 + ((time >> (power - 2)) & 3);
+  }
+
+  // Returns the largest time in a histogram bucket
+  static std::uint32_t bucketLimit(int bucket) {
+    if (bucket < 8)
+      return bucket;
+    int power = (bucket - 8) / 4 + 3;
+    std::uint64_t limit = ((std::uint64_t) (4 + (bucket - 8) % 4 + 1) << (power - 2)) - 1;
+    return limit;
+  }
+
+  // Records a time for the section, in microseconds
+  void record(timing_section section, std::uint32_t time) {
+    Section & stats = sections[section];
+    if (stats.count == 0 || time < stats.min)
+      stats.min = time;
+    if (time > stats.max)
+      stats.max = time;
+    stats.count++;
+    stats.total += time;
+    stats.buckets[bucket(time)]++;
+
+    // Show the section on the trace timeline
+    trace::complete(names[section], time);
+  }
+
+  // Returns the times recorded for the section
+  Summary getSummary(timing_section section) {
+    const Section & stats = sections[section];
+    Summary summary = {stats.count, stats.min, 0, stats.max, 0};
+    if (stats.count == 0)
+      return summary;
+    summary.mean = (double) stats.total / stats.count;
+
+    // Find the bucket holding the 99th percentile, limited by the largest time seen
+    std::uint32_t rank = stats.count - stats.count / 100;
+    std::uint32_t seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+      seen += stats.buckets[i];
+      if (seen >= rank) {
+        summary.p99 = bucketLimit(i) < stats.max ? bucketLimit(i) : stats.max;
+        break;
+      }
+    }
+    return summary;
+  }
+
+  // Writes the times of every section to the message holder
+  void report() {
+    for (int i = 0; i < E_TIMING_SECTION_COUNT; i++) {
+      Summary summary = getSummary((timing_section) i);
+      if (summary.count == 0)
+        continue;
+      char line[128];
+      std::snprintf(line, sizeof(line), "Timing %s: %lu times, min %lu us, mean %.1f us, max %lu us, p99 %lu us", getName((timing_section) i).c_str(), (unsigned long) summary.count, (unsigned long) summary.min, summary.mean, (unsigned long) summary.max, (unsigned long) summary.p99);
+      ports::messageHolder->appendLine(line);
+    }
+  }
+
+  // Clears the times of every section
+  void reset() {
+    for (int i = 0; i < E_TIMING_SECTION_COUNT; i++)
+      sections[i] = Section();
+  }
+#else
+  // Ignore all calls to these functions if timing is not attached
+  void record(timing_section section, std::uint32_t time) {}
+  Summary getSummary(timing_section section) {
+    return Summary();
+  }
+  void report() {}
+  void reset() {}
+#endif
+
+}
@@ -0,0 +1,122 @@
+#include "main.h"
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+
+namespace trace {
+
+  // Recorded events, with the count claimed atomically as events can come from several tasks
+  Event events[MAX_EVENTS];
+  std::atomic<int> count(0);
+  volatile bool tracing = false;
+
+  // The tasks events are tagged against, each claimed by the task the first time it records an event
+  pros::task_t taskHandles[MAX_TASKS];
+  char taskNames[MAX_TASKS][32];
+  std::atomic<int> taskCount(0);
+
+  // Returns the index of the calling task, claiming one if it has not recorded an event
+  static std::uint8_t taskIndex() {
+    pros::task_t task = pros::c::task_get_current();
+    int tasks = taskCount < MAX_TASKS ? taskCount.load() : MAX_TASKS;
+    for (int i = 0; i < tasks; i++)
+      if (taskHandles[i] == task)
+        return i;
+
+    // Only the calling task can claim its own slot, so claiming does not need a lock
+    int index = taskCount++;
+    if (index >= MAX_TASKS)
+      return MAX_TASKS - 1;
+    std::strncpy(taskNames[index], pros::c::task_get_name(task), sizeof(taskNames[index]) - 1);
+    taskNames[index][sizeof(taskNames[index]) - 1] = '\0';
+    taskHandles[index] = task;
+    return index;
+  }
+
+  // Records an event
+  static void record(char phase, const char * name, std::uint32_t duration) {
+    if (!tracing)
+      return;
+
+    std::uint32_t now = util::micros();
+    int index = count++;
+    if (index >= MAX_EVENTS)
+      return;
+
+    Event & event = events[index];
+    event.time = now - duration;
+    event.duration = duration;
+    event.name = name;
+    event.phase = phase;
+    event.task = taskIndex();
+  }
+
+  // Starts a new trace
+  void start() {
+    tracing = false;
+    count = 0;
+    tracing = true;
+  }
+
+  // Stops tracing
+  void stop() {
+    tracing = false;
+  }
+
+  // Returns whether a trace is in progress
+  bool isTracing() {
+    return tracing;
+  }
+
+  // Writes the trace in the text format read by tools/trace.cpp
+  static void write(FILE * file) {
+    int events = count < MAX_EVENTS ? count.load() : MAX_EVENTS;
+    int tasks = taskCount < MAX_TASKS ? taskCount.load() : MAX_TASKS;
+
+    // A header with the amount of events and how many were dropped, then the tasks, then the events
+    std::fprintf(file, "TRC1 %d %d\n", events, count - events);
+    for (int i = 0; i < tasks; i++)
+      std::fprintf(file, "T %d %s\n", i, taskNames[i]);
+    for (int i = 0; i < events; i++) {
+      const Event & event = trace::events[i];
+      std::fprintf(file, "%c %lu %lu %d %s\n", event.phase, (unsigned long) event.time, (unsigned long) event.duration, event.task, event.name);
+    }
+  }
+
+  // Writes the trace to the given file, returning whether it was successful
+  bool save(std::string path) {
+    FILE * file = std::fopen(path.c_str(), "w");
+    if (file == NULL)
+      return false;
+    write(file);
+    std::fclose(file);
+    return true;
+  }
+
+  // Writes the trace to the serial output
+  void print() {
+    write(stdout);
+    std::fflush(stdout);
+  }
+
+  // Records the start of something the calling task is doing
+  void begin(const char * name) {
+    record(PHASE_BEGIN, name, 0);
+  }
+
+  // Records the end of something the calling task was doing
+  void end(const char * name) {
+    record(PHASE_END, name, 0);
+  }
+
+  // Records something happening at an instant
+  void instant(const char * name) {
+    record(PHASE_INSTANT, name, 0);
+  }
+
+  // Records something the calling task has just finished, which took the given duration in microseconds
+  void complete(const char * name, std::uint32_t duration) {
+    record(PHASE_COMPLETE, name, duration);
+  }
+
+}
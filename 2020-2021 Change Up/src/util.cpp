@@ -1,5 +1,8 @@
 #include "main.h"
 
+// High resolution system timer provided by the V5 SDK, in microseconds
+extern "C" std::uint64_t vexSystemHighResTimeGet(void);
+
 namespace util {
 
   // Limits the given number to ±127
@@ -34,4 +37,41 @@ namespace util {
     }
   }
 
+  // Returns the time since the program started, in microseconds
+  std::uint32_t micros() {
+    return vexSystemHighResTimeGet();
+  }
+
+  // The filtered battery voltage, in mV, only updated by sampleBattery(), and whether it has been sampled yet
+  static double filteredBattery = MOTOR_MAX_VOLTAGE;
+  static bool batterySampled = false;
+
+  // Samples the battery voltage, filtered so that momentary sag under load does not cause jumps in output
+  double sampleBattery() {
+    int reading = sensorlog::battery();
+    if (reading > 0) {
+      // Start the filter at the first reading rather than at the maximum voltage
+      filteredBattery = batterySampled ? filteredBattery + (reading - filteredBattery) * 0.1 : reading;
+      batterySampled = true;
+    }
+    return filteredBattery;
+  }
+
+  // Returns the filtered battery voltage of the last sample
+  double getBattery() {
+    return filteredBattery;
+  }
+
+  // Converts a motor power, ranging from -127 to 127, to a voltage in mV, compensating for the filtered battery voltage
+  int powerToVoltage(double power, double battery) {
+    // Scale the power to the reference voltage, in terms of a full battery, and limit it
+    double voltage = limit127(power) / 127.0 * MOTOR_REFERENCE_VOLTAGE * MOTOR_MAX_VOLTAGE / battery;
+    return (voltage > MOTOR_MAX_VOLTAGE ? MOTOR_MAX_VOLTAGE : (voltage < -MOTOR_MAX_VOLTAGE ? -MOTOR_MAX_VOLTAGE : voltage));
+  }
+
+  // Converts a voltage in mV to the motor power giving it, the inverse of powerToVoltage()
+  double voltageToPower(double voltage, double battery) {
+    return voltage * battery / MOTOR_MAX_VOLTAGE / MOTOR_REFERENCE_VOLTAGE * 127.0;
+  }
+
 }
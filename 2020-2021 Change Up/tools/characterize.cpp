@@ -0,0 +1,147 @@
+/*
+ * Fits the drive feedforward constants to the samples recorded by characterize::run()
+ *
+ * Runs on a computer, not the robot. Build and run with:
+ *   g++ -O2 -std=c++17 -o characterize tools/characterize.cpp
+ *   ./characterize characterize.csv
+ *
+ * The drive is modelled as voltage = kS * sgn(velocity) + kV * velocity + kA * acceleration, fitted
+ * with ordinary least squares over every sample where the robot is moving
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// A single drive sample, matching characterize::Sample
+struct Sample {
+  int test;
+  int time;
+  double voltage;
+  double battery;
+  double position;
+  double velocity;
+  double acceleration;
+};
+
+// Reads the samples from the CSV file written by the robot
+std::vector<Sample> readSamples(const std::string & path) {
+  std::vector<Sample> samples;
+  std::ifstream file(path);
+  std::string line;
+
+  // Skip the header
+  std::getline(file, line);
+  while (std::getline(file, line)) {
+    Sample sample;
+    if (std::sscanf(line.c_str(), "%d,%d,%lf,%lf,%lf,%lf,%lf", &sample.test, &sample.time, &sample.voltage, &sample.battery, &sample.position, &sample.velocity, &sample.acceleration) == 7)
+      samples.push_back(sample);
+  }
+  return samples;
+}
+
+// Solves the 3x3 system a * x = b with Gaussian elimination, returning whether it has a solution
+bool solve(double a[3][3], double b[3], double x[3]) {
+  for (int col = 0; col < 3; col++) {
+    // Pick the largest pivot
+    int pivot = col;
+    for (int row = col + 1; row < 3; row++)
+      if (std::fabs(a[row][col]) > std::fabs(a[pivot][col]))
+        pivot = row;
+    if (std::fabs(a[pivot][col]) < 1e-12)
+      return false;
+    for (int i = 0; i < 3; i++)
+      std::swap(a[col][i], a[pivot][i]);
+    std::swap(b[col], b[pivot]);
+
+    // Eliminate the column from the rows below
+    for (int row = col + 1; row < 3; row++) {
+      double factor = a[row][col] / a[col][col];
+      for (int i = col; i < 3; i++)
+        a[row][i] -= factor * a[col][i];
+      b[row] -= factor * b[col];
+    }
+  }
+
+  // Back substitute
+  for (int row = 2; row >= 0; row--) {
+    x[row] = b[row];
+    for (int i = row + 1; i < 3; i++)
+      x[row] -= a[row][i] * x[i];
+    x[row] /= a[row][row];
+  }
+  return true;
+}
+
+int main(int argc, char ** argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " <characterize.csv> [minimum velocity, in/s]" << std::endl;
+    return 1;
+  }
+
+  // Samples slower than this are treated as stationary and ignored, as static friction is not linear
+  double minVelocity = argc > 2 ? std::atof(argv[2]) : 0.5;
+
+  std::vector<Sample> samples = readSamples(argv[1]);
+  if (samples.empty()) {
+    std::cerr << "No samples read from " << argv[1] << std::endl;
+    return 1;
+  }
+
+  // Accumulate the normal equations for [sgn(v), v, a]
+  double ata[3][3] = {};
+  double atb[3] = {};
+  double sumVoltage = 0;
+  double sumVoltageSquared = 0;
+  int used = 0;
+  for (int i = 1; i < (int) samples.size(); i++) {
+    const Sample & sample = samples[i];
+    // Skip stationary samples and the first sample of each test, whose acceleration spans two tests
+    if (std::fabs(sample.velocity) < minVelocity || sample.test != samples[i - 1].test)
+      continue;
+
+    double row[3] = {sample.velocity < 0 ? -1.0 : 1.0, sample.velocity, sample.acceleration};
+    for (int r = 0; r < 3; r++) {
+      for (int c = 0; c < 3; c++)
+        ata[r][c] += row[r] * row[c];
+      atb[r] += row[r] * sample.voltage;
+    }
+    sumVoltage += sample.voltage;
+    sumVoltageSquared += sample.voltage * sample.voltage;
+    used++;
+  }
+
+  double x[3];
+  if (used < 3 || !solve(ata, atb, x)) {
+    std::cerr << "Not enough moving samples to fit, " << used << " of " << samples.size() << " used" << std::endl;
+    return 1;
+  }
+  double kS = x[0];
+  double kV = x[1];
+  double kA = x[2];
+
+  // Calculate the coefficient of determination
+  double residual = 0;
+  for (int i = 1; i < (int) samples.size(); i++) {
+    const Sample & sample = samples[i];
+    if (std::fabs(sample.velocity) < minVelocity || sample.test != samples[i - 1].test)
+      continue;
+    double predicted = kS * (sample.velocity < 0 ? -1 : 1) + kV * sample.velocity + kA * sample.acceleration;
+    residual += (sample.voltage - predicted) * (sample.voltage - predicted);
+  }
+  double total = sumVoltageSquared - sumVoltage * sumVoltage / used;
+  double r2 = total > 0 ? 1 - residual / total : 0;
+
+  std::printf("Samples used: %d of %zu\n", used, samples.size());
+  std::printf("kS: %.4f V\n", kS);
+  std::printf("kV: %.4f V per in/s\n", kV);
+  std::printf("kA: %.4f V per in/s^2\n", kA);
+  std::printf("r^2: %.4f\n", r2);
+  std::printf("\nports::pid->setDriveFeedforward(%.4f, %.4f, %.4f, <acceleration>);\n", kS, kV, kA);
+  return 0;
+}
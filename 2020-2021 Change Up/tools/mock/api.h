@@ -0,0 +1,223 @@
+/*
+ * Mock of the parts of the PROS API used by the robot code, so it can be compiled and run on a computer
+ *
+ * Force-include this before any robot header with -include tools/mock/api.h. It defines the PROS API include
+ * guard, so include/api.h is skipped. Devices report fixed values, as the values the control code sees
+ * come through the sensor log seam (include/sensorlog.hpp), which each tool implements with its own
+ * source of device values. Tasks are not started, and delays only advance the mock clock, so all code
+ * runs on the calling thread
+ */
+
+#ifndef _PROS_API_H_
+#define _PROS_API_H_
+
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#define PROS_ERR (INT32_MAX)
+#define PROS_ERR_F (INFINITY)
+
+#define TASK_PRIORITY_MIN 1
+#define TASK_PRIORITY_DEFAULT 8
+#define TASK_STACK_DEPTH_DEFAULT 0x2000
+
+namespace mock {
+
+  // The mock clock, in ms, advanced by delays and by the tools
+  extern std::uint32_t clock;
+  // Called with the length of every delay, before the clock is advanced
+  extern void (* onDelay)(std::uint32_t ms);
+
+}
+
+namespace pros {
+
+typedef void * task_t;
+typedef void (* task_fn_t)(void *);
+
+typedef enum {
+  E_CONTROLLER_MASTER = 0,
+  E_CONTROLLER_PARTNER
+} controller_id_e_t;
+#define CONTROLLER_MASTER pros::E_CONTROLLER_MASTER
+#define CONTROLLER_PARTNER pros::E_CONTROLLER_PARTNER
+
+typedef enum {
+  E_CONTROLLER_ANALOG_LEFT_X = 0,
+  E_CONTROLLER_ANALOG_LEFT_Y,
+  E_CONTROLLER_ANALOG_RIGHT_X,
+  E_CONTROLLER_ANALOG_RIGHT_Y
+} controller_analog_e_t;
+
+typedef enum {
+  E_CONTROLLER_DIGITAL_L1 = 6,
+  E_CONTROLLER_DIGITAL_L2,
+  E_CONTROLLER_DIGITAL_R1,
+  E_CONTROLLER_DIGITAL_R2,
+  E_CONTROLLER_DIGITAL_UP,
+  E_CONTROLLER_DIGITAL_DOWN,
+  E_CONTROLLER_DIGITAL_LEFT,
+  E_CONTROLLER_DIGITAL_RIGHT,
+  E_CONTROLLER_DIGITAL_X,
+  E_CONTROLLER_DIGITAL_B,
+  E_CONTROLLER_DIGITAL_Y,
+  E_CONTROLLER_DIGITAL_A
+} controller_digital_e_t;
+
+typedef enum {
+  E_MOTOR_BRAKE_COAST = 0,
+  E_MOTOR_BRAKE_BRAKE = 1,
+  E_MOTOR_BRAKE_HOLD = 2
+} motor_brake_mode_e_t;
+
+typedef enum {
+  E_MOTOR_ENCODER_DEGREES = 0,
+  E_MOTOR_ENCODER_ROTATIONS = 1,
+  E_MOTOR_ENCODER_COUNTS = 2
+} motor_encoder_units_e_t;
+
+typedef enum {
+  E_MOTOR_GEARSET_36 = 0,
+  E_MOTOR_GEARSET_18 = 1,
+  E_MOTOR_GEARSET_06 = 2
+} motor_gearset_e_t;
+
+typedef enum {
+  E_NOTIFY_ACTION_NONE,
+  E_NOTIFY_ACTION_BITS,
+  E_NOTIFY_ACTION_INCR,
+  E_NOTIFY_ACTION_OWRITE,
+  E_NOTIFY_ACTION_NO_OWRITE
+} notify_action_e_t;
+
+namespace c {
+
+  struct imu_raw_s {
+    double x;
+    double y;
+    double z;
+  };
+  typedef struct imu_raw_s imu_gyro_s_t;
+  typedef struct imu_raw_s imu_accel_s_t;
+
+  // Returns the mock task of the calling code, which is always the same as there is only one thread
+  task_t task_get_current();
+  // Returns the name of the mock task
+  char * task_get_name(task_t task);
+  // Returns the amount of tasks, none as no tasks are started
+  std::uint32_t task_get_count();
+
+}
+
+// Returns the mock clock
+std::uint32_t millis();
+// Advances the mock clock
+void delay(std::uint32_t ms);
+
+namespace battery {
+  std::int32_t get_voltage();
+}
+
+namespace lcd {
+  typedef void (* lcd_btn_cb_fn_t)(void);
+  bool initialize();
+  bool set_text(std::int16_t line, std::string text);
+  void register_btn0_cb(lcd_btn_cb_fn_t cb);
+  void register_btn1_cb(lcd_btn_cb_fn_t cb);
+  void register_btn2_cb(lcd_btn_cb_fn_t cb);
+}
+
+class Task {
+  task_t task;
+
+public:
+  // Records the task without running it
+  Task(task_fn_t function, void * parameters = NULL, std::uint32_t prio = TASK_PRIORITY_DEFAULT, std::uint16_t stack_depth = TASK_STACK_DEPTH_DEFAULT, const char * name = "");
+
+  void suspend();
+  void resume();
+  void remove();
+  operator task_t() {
+    return task;
+  }
+
+  static void delay_until(std::uint32_t * const prev_time, const std::uint32_t delta);
+};
+
+class Controller {
+  controller_id_e_t id;
+
+public:
+  explicit Controller(controller_id_e_t id);
+
+  std::int32_t is_connected();
+  std::int32_t get_analog(controller_analog_e_t channel);
+  std::int32_t get_digital(controller_digital_e_t button);
+  std::int32_t rumble(const char * rumble_pattern);
+  std::int32_t set_text(std::uint8_t line, std::uint8_t col, std::string str);
+};
+
+class Motor {
+  std::uint8_t port;
+  mutable motor_gearset_e_t gearset;
+  bool reverse;
+  motor_encoder_units_e_t encoderUnits;
+  mutable motor_brake_mode_e_t brakeMode = E_MOTOR_BRAKE_COAST;
+
+public:
+  explicit Motor(const std::uint8_t port, const motor_gearset_e_t gearset = E_MOTOR_GEARSET_18, const bool reverse = false, const motor_encoder_units_e_t encoderUnits = E_MOTOR_ENCODER_DEGREES);
+  virtual ~Motor() = default;
+
+  virtual std::int32_t move(std::int32_t voltage) const;
+  virtual std::int32_t move_voltage(const std::int32_t voltage) const;
+  virtual std::int32_t move_velocity(const std::int32_t velocity) const;
+  virtual std::int32_t move_absolute(const double position, const std::int32_t velocity) const;
+  virtual std::int32_t move_relative(const double position, const std::int32_t velocity) const;
+  virtual std::int32_t tare_position(void) const;
+  virtual std::int32_t set_brake_mode(const motor_brake_mode_e_t mode) const;
+  virtual std::int32_t set_encoder_units(const motor_encoder_units_e_t units) const;
+  virtual std::int32_t set_gearing(const motor_gearset_e_t gearset) const;
+  virtual motor_brake_mode_e_t get_brake_mode(void) const;
+  virtual double get_position(void) const;
+  virtual double get_temperature(void) const;
+  virtual double get_efficiency(void) const;
+  virtual motor_gearset_e_t get_gearing(void) const;
+  virtual std::uint8_t get_port(void) const;
+};
+
+class Imu {
+  const std::uint8_t _port;
+
+public:
+  Imu(const std::uint8_t port) : _port(port) {};
+  virtual ~Imu() = default;
+
+  virtual std::int32_t reset() const;
+  virtual bool is_calibrating() const;
+  virtual double get_yaw() const;
+  virtual double get_pitch() const;
+  virtual double get_roll() const;
+  virtual c::imu_accel_s_t get_accel() const;
+  virtual c::imu_gyro_s_t get_gyro_rate() const;
+};
+
+class ADIUltrasonic {
+public:
+  ADIUltrasonic(std::uint8_t port_ping, std::uint8_t port_echo);
+  std::int32_t get_value() const;
+};
+
+class ADIGyro {
+public:
+  ADIGyro(std::uint8_t port, double multiplier = 1);
+  double get_value() const;
+};
+
+}
+
+#endif
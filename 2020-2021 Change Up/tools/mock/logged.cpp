@@ -0,0 +1,48 @@
+/*
+ * LoggedMotor and LoggedImu for the tools, passing every call to the sensor log seam instead of a device,
+ * so the tool's implementation of sensorlog::record() decides what the code reads
+ */
+
+#include "main.h"
+
+LoggedMotor::LoggedMotor(std::uint8_t port, pros::motor_gearset_e_t gearset, bool reverse, pros::motor_encoder_units_e_t encoderUnits) : pros::Motor(port, gearset, reverse, encoderUnits) {}
+
+std::int32_t LoggedMotor::move(std::int32_t voltage) const {
+  sensorlog::record(get_port(), sensorlog::E_SENSOR_MOVE, voltage);
+  return 1;
+}
+
+std::int32_t LoggedMotor::move_voltage(std::int32_t voltage) const {
+  sensorlog::record(get_port(), sensorlog::E_SENSOR_MOVE_VOLTAGE, voltage);
+  return 1;
+}
+
+std::int32_t LoggedMotor::move_velocity(std::int32_t velocity) const {
+  sensorlog::record(get_port(), sensorlog::E_SENSOR_MOVE_VELOCITY, velocity);
+  return 1;
+}
+
+std::int32_t LoggedMotor::tare_position() const {
+  sensorlog::record(get_port(), sensorlog::E_SENSOR_TARE, 0);
+  return 1;
+}
+
+double LoggedMotor::get_position() const {
+  return sensorlog::record(get_port(), sensorlog::E_SENSOR_POSITION, 0);
+}
+
+LoggedImu::LoggedImu(std::uint8_t port) : pros::Imu(port) {
+  LoggedImu::port = port;
+}
+
+double LoggedImu::get_yaw() const {
+  return sensorlog::record(port, sensorlog::E_SENSOR_YAW, 0);
+}
+
+double LoggedImu::get_pitch() const {
+  return sensorlog::record(port, sensorlog::E_SENSOR_PITCH, 0);
+}
+
+double LoggedImu::get_roll() const {
+  return sensorlog::record(port, sensorlog::E_SENSOR_ROLL, 0);
+}
@@ -0,0 +1,214 @@
+/*
+ * Implementation of the mock PROS API in tools/mock/api.h
+ */
+
+#include "api.h"
+
+namespace mock {
+
+  std::uint32_t clock = 0;
+  void (* onDelay)(std::uint32_t ms) = NULL;
+
+}
+
+namespace pros {
+
+namespace c {
+
+  task_t task_get_current() {
+    static int current;
+    return &current;
+  }
+
+  char * task_get_name(task_t task) {
+    static char name[] = "Mock";
+    return name;
+  }
+
+  std::uint32_t task_get_count() {
+    return 0;
+  }
+
+}
+
+std::uint32_t millis() {
+  return mock::clock;
+}
+
+void delay(std::uint32_t ms) {
+  if (mock::onDelay != NULL)
+    mock::onDelay(ms);
+  mock::clock += ms;
+}
+
+namespace battery {
+  std::int32_t get_voltage() {
+    return 12000;
+  }
+}
+
+namespace lcd {
+  bool initialize() {
+    return true;
+  }
+  bool set_text(std::int16_t line, std::string text) {
+    return true;
+  }
+  void register_btn0_cb(lcd_btn_cb_fn_t cb) {}
+  void register_btn1_cb(lcd_btn_cb_fn_t cb) {}
+  void register_btn2_cb(lcd_btn_cb_fn_t cb) {}
+}
+
+Task::Task(task_fn_t function, void * parameters, std::uint32_t prio, std::uint16_t stack_depth, const char * name) {
+  // Give each task a distinct handle, which is never the current task
+  task = new int;
+}
+
+void Task::suspend() {}
+void Task::resume() {}
+void Task::remove() {}
+
+void Task::delay_until(std::uint32_t * const prev_time, const std::uint32_t delta) {
+  *prev_time += delta;
+  if (*prev_time > mock::clock)
+    delay(*prev_time - mock::clock);
+}
+
+Controller::Controller(controller_id_e_t id) : id(id) {}
+
+std::int32_t Controller::is_connected() {
+  return 0;
+}
+
+std::int32_t Controller::get_analog(controller_analog_e_t channel) {
+  return 0;
+}
+
+std::int32_t Controller::get_digital(controller_digital_e_t button) {
+  return 0;
+}
+
+std::int32_t Controller::rumble(const char * rumble_pattern) {
+  return 1;
+}
+
+std::int32_t Controller::set_text(std::uint8_t line, std::uint8_t col, std::string str) {
+  return 1;
+}
+
+Motor::Motor(const std::uint8_t port, const motor_gearset_e_t gearset, const bool reverse, const motor_encoder_units_e_t encoderUnits) : port(port), gearset(gearset), reverse(reverse), encoderUnits(encoderUnits) {}
+
+std::int32_t Motor::move(std::int32_t voltage) const {
+  return 1;
+}
+
+std::int32_t Motor::move_voltage(const std::int32_t voltage) const {
+  return 1;
+}
+
+std::int32_t Motor::move_velocity(const std::int32_t velocity) const {
+  return 1;
+}
+
+std::int32_t Motor::move_absolute(const double position, const std::int32_t velocity) const {
+  return 1;
+}
+
+std::int32_t Motor::move_relative(const double position, const std::int32_t velocity) const {
+  return 1;
+}
+
+std::int32_t Motor::tare_position(void) const {
+  return 1;
+}
+
+std::int32_t Motor::set_brake_mode(const motor_brake_mode_e_t mode) const {
+  brakeMode = mode;
+  return 1;
+}
+
+std::int32_t Motor::set_encoder_units(const motor_encoder_units_e_t units) const {
+  return 1;
+}
+
+std::int32_t Motor::set_gearing(const motor_gearset_e_t gearset) const {
+  Motor::gearset = gearset;
+  return 1;
+}
+
+motor_brake_mode_e_t Motor::get_brake_mode(void) const {
+  return brakeMode;
+}
+
+double Motor::get_position(void) const {
+  return 0;
+}
+
+double Motor::get_temperature(void) const {
+  return 20;
+}
+
+double Motor::get_efficiency(void) const {
+  return 100;
+}
+
+motor_gearset_e_t Motor::get_gearing(void) const {
+  return gearset;
+}
+
+std::uint8_t Motor::get_port(void) const {
+  return port;
+}
+
+std::int32_t Imu::reset() const {
+  return 1;
+}
+
+bool Imu::is_calibrating() const {
+  return false;
+}
+
+double Imu::get_yaw() const {
+  return 0;
+}
+
+double Imu::get_pitch() const {
+  return 0;
+}
+
+double Imu::get_roll() const {
+  return 0;
+}
+
+c::imu_accel_s_t Imu::get_accel() const {
+  return {0, 0, 0};
+}
+
+c::imu_gyro_s_t Imu::get_gyro_rate() const {
+  return {0, 0, 0};
+}
+
+ADIUltrasonic::ADIUltrasonic(std::uint8_t port_ping, std::uint8_t port_echo) {}
+
+std::int32_t ADIUltrasonic::get_value() const {
+  return 0;
+}
+
+ADIGyro::ADIGyro(std::uint8_t port, double multiplier) {}
+
+double ADIGyro::get_value() const {
+  return 0;
+}
+
+}
+
+// Task state, with no tasks as none are started
+extern "C" unsigned long uxTaskGetSystemState(void * statuses, unsigned long size, std::uint32_t * totalRunTime) {
+  *totalRunTime = 0;
+  return 0;
+}
+
+// High resolution system timer provided by the V5 SDK, in microseconds
+extern "C" std::uint64_t vexSystemHighResTimeGet(void) {
+  return (std::uint64_t) mock::clock * 1000;
+}
@@ -0,0 +1,243 @@
+// Replays a sensor log recorded during autonomous through the robot code, checking that the code makes
+// exactly the same device writes and measuring the CPU time of each control loop iteration
+//
+// Runs on a computer, not the robot. Build from the project directory and run with:
+//   g++ -O2 -std=gnu++17 -include tools/mock/api.h -Iinclude -o replay tools/replay.cpp tools/mock/*.cpp $(ls src/*.cpp | grep -v sensorlog.cpp)
+//   ./replay sensors.log [maximum mean iteration time, in us]
+//
+// The robot code runs against the mock PROS layer in tools/mock, with this file implementing the sensor log
+// seam: every read made by the autonomous task returns the logged value, and every write is compared with
+// the logged write. The gyro task is replayed in step, by updating the gyro whenever the log shows the task
+// ran. Exits with 1 if the code diverges from the log, and 2 if the iterations are slower than the maximum
+
+#include "main.h"
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+namespace replay {
+
+  // Thrown when the log runs out before autonomous finishes, as happens when the field ends autonomous
+  struct LogEnded {};
+
+  // The log being replayed and the autonomous it was recorded with
+  std::vector<sensorlog::Record> records;
+  int autonomous = 0;
+
+  // Whether autonomous has started the log, and the next record of the autonomous and gyro tasks
+  bool active = false;
+  std::size_t next[2] = {};
+  // Whether the gyro task is being replayed
+  bool inGyro = false;
+
+  // Counts of what has been checked
+  int reads = 0;
+  int writes = 0;
+  int gyroUpdates = 0;
+
+  // Iteration timing, excluding the time spent replaying the gyro task
+  std::chrono::steady_clock::time_point iterationStart;
+  double excluded = 0;
+  std::vector<double> iterations;
+
+  // Returns whether the channel is a read rather than a write
+  bool isRead(int channel) {
+    return channel <= sensorlog::E_SENSOR_ROLL;
+  }
+
+  // Returns the name of the channel
+  std::string channelName(int channel) {
+    static const char * names[] = {"millis", "battery", "position", "yaw", "pitch", "roll", "move", "move_voltage", "move_velocity", "tare_position"};
+    return channel >= 0 && channel <= sensorlog::E_SENSOR_TARE ? names[channel] : "unknown";
+  }
+
+  // Returns the index of the next record of the given task from the given index
+  std::size_t find(int task, std::size_t from) {
+    while (from < records.size() && records[from].task != task)
+      from++;
+    return from;
+  }
+
+  // Replays every gyro task update logged before the next record of the autonomous task
+  void catchUpGyro() {
+    auto start = std::chrono::steady_clock::now();
+    next[sensorlog::TASK_LOGGED] = find(sensorlog::TASK_LOGGED, next[sensorlog::TASK_LOGGED]);
+
+    while (true) {
+      std::size_t gyro = next[sensorlog::TASK_GYRO] = find(sensorlog::TASK_GYRO, next[sensorlog::TASK_GYRO]);
+      if (gyro >= next[sensorlog::TASK_LOGGED] || gyro >= records.size())
+        break;
+
+      // Each update starts by reading the roll; skip the rest of an update cut off by the start of the log
+      if (records[gyro].channel != sensorlog::E_SENSOR_ROLL) {
+        next[sensorlog::TASK_GYRO]++;
+        continue;
+      }
+      inGyro = true;
+      ports::gyro->update();
+      inGyro = false;
+      gyroUpdates++;
+    }
+
+    excluded += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  // Takes the next record of the running task, checking it matches the call being made
+  const sensorlog::Record & take(int port, int channel, double value) {
+    int task = inGyro ? sensorlog::TASK_GYRO : sensorlog::TASK_LOGGED;
+    if (task == sensorlog::TASK_LOGGED)
+      catchUpGyro();
+
+    std::size_t index = next[task] = find(task, next[task]);
+    if (index >= records.size())
+      throw LogEnded();
+    const sensorlog::Record & record = records[index];
+    next[task]++;
+
+    // Keep the mock clock with the log, for any timing not read through the log
+    mock::clock = record.time / 1000;
+
+    char message[256];
+    if (record.port != port || record.channel != channel) {
+      std::snprintf(message, sizeof(message), "record %zu: expected %s on port %d, but the code called %s on port %d", index, channelName(record.channel).c_str(), record.port, channelName(channel).c_str(), port);
+      throw std::runtime_error(message);
+    }
+    if (!isRead(channel) && record.value != value) {
+      std::snprintf(message, sizeof(message), "record %zu: expected %s of %g on port %d, but the code sent %g", index, channelName(channel).c_str(), record.value, port, value);
+      throw std::runtime_error(message);
+    }
+
+    if (isRead(channel))
+      reads++;
+    else
+      writes++;
+    return record;
+  }
+
+  // Records the time of each autonomous iteration, which ends when the task delays
+  void onDelay(std::uint32_t ms) {
+    auto now = std::chrono::steady_clock::now();
+    if (active && !inGyro)
+      iterations.push_back(std::chrono::duration<double, std::micro>(now - iterationStart).count() - excluded);
+    iterationStart = now;
+    excluded = 0;
+  }
+
+  // Reads the log written by sensorlog::save(), returning whether it was successful
+  bool load(const std::string & path) {
+    FILE * file = std::fopen(path.c_str(), "rb");
+    if (file == NULL)
+      return false;
+
+    char magic[4] = {};
+    std::int32_t header[2] = {};
+    bool valid = std::fread(magic, 1, 4, file) == 4 && std::string(magic, 4) == "SNS1";
+    valid = valid && std::fread(header, sizeof(header[0]), 2, file) == 2 && header[1] >= 0;
+    if (valid) {
+      autonomous = header[0];
+      records.resize(header[1]);
+      valid = (std::int32_t) std::fread(records.data(), sizeof(sensorlog::Record), header[1], file) == header[1];
+    }
+    std::fclose(file);
+    return valid;
+  }
+
+}
+
+// The sensor log seam, serving the logged values instead of recording them
+namespace sensorlog {
+
+  // Starts replaying once autonomous reaches the point the log was started from
+  void start(int autonomous) {
+    replay::active = true;
+    replay::next[TASK_LOGGED] = 0;
+    replay::next[TASK_GYRO] = 0;
+    replay::iterationStart = std::chrono::steady_clock::now();
+  }
+
+  // Stops replaying, checking the code made every logged call
+  void stop() {
+    replay::catchUpGyro();
+    replay::active = false;
+    if (replay::next[TASK_LOGGED] < replay::records.size()) {
+      const Record & record = replay::records[replay::next[TASK_LOGGED]];
+      throw std::runtime_error("record " + std::to_string(replay::next[TASK_LOGGED]) + ": autonomous finished, but the log continues with " + replay::channelName(record.channel) + " on port " + std::to_string(record.port));
+    }
+  }
+
+  bool isLogging() {
+    return false;
+  }
+
+  bool save(std::string path) {
+    return false;
+  }
+
+  // Returns the logged value for reads, and checks writes against the log
+  double record(int port, sensor_channel channel, double value) {
+    if (!replay::active)
+      return value;
+    const Record & record = replay::take(port, channel, value);
+    return replay::isRead(channel) ? record.value : value;
+  }
+
+  std::uint32_t millis() {
+    return record(0, E_SENSOR_MILLIS, pros::millis());
+  }
+
+  std::int32_t battery() {
+    return record(0, E_SENSOR_BATTERY, pros::battery::get_voltage());
+  }
+
+}
+
+int main(int argc, char ** argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " <sensors.log> [maximum mean iteration time, in us]" << std::endl;
+    return 1;
+  }
+  if (!replay::load(argv[1])) {
+    std::cerr << "Could not read a sensor log from " << argv[1] << std::endl;
+    return 1;
+  }
+  // Driver-controlled routines depend on controller input, which is not logged
+  if (replay::autonomous == 6 || replay::autonomous == 9) {
+    std::cerr << "Autonomous " << replay::autonomous << " is driver controlled and cannot be replayed" << std::endl;
+    return 1;
+  }
+
+  // Configure the robot as it starts up, then run the logged autonomous
+  initialize();
+  selectedAutonomous = replay::autonomous;
+  mock::onDelay = replay::onDelay;
+  bool complete = true;
+  try {
+    autonomous();
+  } catch (replay::LogEnded &) {
+    complete = false;
+  } catch (std::runtime_error & e) {
+    std::cerr << "Diverged from the log at " << e.what() << std::endl;
+    return 1;
+  }
+
+  std::printf("Autonomous %d, %zu records%s\n", replay::autonomous, replay::records.size(), complete ? "" : ", ended before autonomous finished");
+  std::printf("Matched %d reads, %d writes and %d gyro updates\n", replay::reads, replay::writes, replay::gyroUpdates);
+
+  // Summarize the iteration times
+  std::vector<double> & iterations = replay::iterations;
+  if (iterations.empty())
+    return 0;
+  std::sort(iterations.begin(), iterations.end());
+  double total = 0;
+  for (double time : iterations)
+    total += time;
+  double mean = total / iterations.size();
+  std::printf("Iterations: %zu, mean %.2f us, p99 %.2f us, max %.2f us\n", iterations.size(), mean, iterations[iterations.size() * 99 / 100], iterations.back());
+
+  if (argc > 2 && mean > std::atof(argv[2])) {
+    std::cerr << "Mean iteration time is above the maximum of " << argv[2] << " us" << std::endl;
+    return 2;
+  }
+  return 0;
+}
@@ -0,0 +1,329 @@
+// Runs the autonomous routines against a simulated robot and reports how long each motion took, where the
+// robot ended up and how many motions timed out, as JSON that can be diffed between commits
+//
+// Runs on a computer, not the robot. Build from the project directory and run with:
+//   g++ -O2 -std=gnu++17 -include tools/mock/api.h -Iinclude -o simulate tools/simulate.cpp tools/mock/*.cpp $(ls src/*.cpp | grep -v sensorlog.cpp)
+//   ./simulate [autonomous numbers] > report.json
+//
+// The robot code runs against the mock PROS layer in tools/mock, with this file implementing the sensor log
+// seam from a simulation stepped every simulated millisecond. Each motor follows its command with a first
+// order lag, and the drive wheels move the robot as an X-drive. Everything runs on simulated time, so the
+// report is the same on every run of the same code
+//
+// The final pose error is the distance and heading between where the robot ended up and where it would be
+// had every motion reached its target exactly
+
+#include "main.h"
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace simulation {
+
+  // Motor model: the voltage needed to overcome static friction, in mV, and the time constants, in seconds
+  const double STATIC_VOLTAGE = 600;
+  const double DRIVE_TIME_CONSTANT = 0.12;
+  const double VELOCITY_TIME_CONSTANT = 0.05;
+  const double BRAKE_TIME_CONSTANT = 0.04;
+  const double COAST_TIME_CONSTANT = 0.6;
+  // Distance from the centre of the robot to each drive wheel, along the direction it rolls, in inches
+  const double TURN_RADIUS = 9;
+  // The battery voltage reported, in mV
+  const int BATTERY_VOLTAGE = 12000;
+  // The longest a routine may run before it is stopped, in ms
+  const std::uint32_t MAX_ROUTINE_TIME = 120000;
+  // The gyro task's period, in ms
+  const int GYRO_PERIOD = 15;
+
+  // Thrown when a routine runs for longer than the maximum time
+  struct RoutineTimeout {};
+
+  // The state of a motor, in degrees and degrees per second
+  struct MotorState {
+    bool velocityMode = false;
+    double command = 0; // in mV, or rpm in velocity mode
+    double velocity = 0;
+    double position = 0;
+  };
+  MotorState motors[22];
+
+  // The robot's pose, in inches and degrees clockwise, and the pose it would have if every motion were exact
+  double x = 0;
+  double y = 0;
+  double heading = 0;
+  double idealX = 0;
+  double idealY = 0;
+  double idealHeading = 0;
+
+  // A completed motion
+  struct Step {
+    std::string name;
+    std::uint32_t start;
+    std::uint32_t end;
+    double error;
+    bool stalled;
+    bool timedOut;
+  };
+  std::vector<Step> steps;
+  // Time the routine started, and the time and pose at the end of the last motion
+  std::uint32_t routineStart = 0;
+  std::uint32_t stepStart = 0;
+  double stepX = 0;
+  double stepY = 0;
+  double stepHeading = 0;
+
+  // Returns the motor on the given port, or NULL if the port is not used by the robot
+  pros::Motor * motorOn(int port) {
+    pros::Motor * all[] = {ports::frontLeftDrive, ports::backLeftDrive, ports::frontRightDrive, ports::backRightDrive, ports::intakeMotorLeft, ports::intakeMotorRight, ports::indexer, ports::flywheel};
+    for (pros::Motor * motor : all)
+      if (motor != NULL && motor->get_port() == port)
+        return motor;
+    return NULL;
+  }
+
+  // Returns the free speed of a gearset, in degrees per second
+  double freeSpeed(pros::motor_gearset_e_t gearset) {
+    switch (gearset) {
+      case pros::E_MOTOR_GEARSET_36:
+        return 100 * 6;
+      case pros::E_MOTOR_GEARSET_06:
+        return 600 * 6;
+      default:
+        return 200 * 6;
+    }
+  }
+
+  // Advances a motor by the given time, in seconds
+  void stepMotor(int port, double dt) {
+    pros::Motor * motor = motorOn(port);
+    if (motor == NULL)
+      return;
+    MotorState & state = motors[port];
+
+    // All drive wheels use the front left's gearset, as the control code assumes a single drive ratio
+    bool drive = motor == ports::frontLeftDrive || motor == ports::backLeftDrive || motor == ports::frontRightDrive || motor == ports::backRightDrive;
+    double speed = freeSpeed((drive ? ports::frontLeftDrive : motor)->get_gearing());
+
+    double target = 0;
+    double timeConstant = DRIVE_TIME_CONSTANT;
+    if (state.velocityMode) {
+      target = state.command * 6;
+      timeConstant = VELOCITY_TIME_CONSTANT;
+    } else if (state.command == 0)
+      timeConstant = motor->get_brake_mode() == pros::E_MOTOR_BRAKE_COAST ? COAST_TIME_CONSTANT : BRAKE_TIME_CONSTANT;
+    else if (std::fabs(state.command) > STATIC_VOLTAGE)
+      target = (state.command - std::copysign(STATIC_VOLTAGE, state.command)) / (MOTOR_MAX_VOLTAGE - STATIC_VOLTAGE) * speed;
+
+    state.velocity += (target - state.velocity) * dt / timeConstant;
+    state.position += state.velocity * dt;
+  }
+
+  // Advances the simulation by a millisecond
+  void step() {
+    const double dt = 0.001;
+    for (int port = 1; port <= 21; port++)
+      stepMotor(port, dt);
+
+    // Find the forward, turning and strafing speeds of the X-drive, in inches per second
+    double ratio = PID::getGearRatio();
+    double frontLeft = motors[ports::frontLeftDrive->get_port()].velocity / ratio;
+    double backLeft = motors[ports::backLeftDrive->get_port()].velocity / ratio;
+    double frontRight = motors[ports::frontRightDrive->get_port()].velocity / ratio;
+    double backRight = motors[ports::backRightDrive->get_port()].velocity / ratio;
+    double forward = (frontLeft + backLeft + frontRight + backRight) / 4;
+    double turn = (frontLeft + backLeft - frontRight - backRight) / 4;
+    double strafe = (frontLeft - backLeft - frontRight + backRight) / 4;
+
+    // Move the robot, with the heading measured clockwise from forward
+    double radians = heading * M_PI / 180;
+    x += (forward * std::sin(radians) + strafe * std::cos(radians)) * dt;
+    y += (forward * std::cos(radians) - strafe * std::sin(radians)) * dt;
+    heading += turn / TURN_RADIUS * 180 / M_PI * dt;
+  }
+
+  // Runs the simulation for the length of each delay, updating the gyro as its task would
+  void onDelay(std::uint32_t ms) {
+    for (std::uint32_t i = 1; i <= ms; i++) {
+      step();
+      if ((mock::clock + i) % GYRO_PERIOD == 0)
+        ports::gyro->update();
+    }
+    if (mock::clock + ms - routineStart > MAX_ROUTINE_TIME)
+      throw RoutineTimeout();
+  }
+
+  // Records each motion as it ends, moving the ideal pose by what the motion was aiming for
+  void onMotion(std::string name, double error) {
+    double radians = stepHeading * M_PI / 180;
+    double dx = x - stepX;
+    double dy = y - stepY;
+    double idealRadians = idealHeading * M_PI / 180;
+
+    if (name == "Pivot")
+      idealHeading = heading + error;
+    else if (name == "Strafe") {
+      double distance = dx * std::cos(radians) - dy * std::sin(radians) + error;
+      idealX += distance * std::cos(idealRadians);
+      idealY -= distance * std::sin(idealRadians);
+    } else {
+      double distance = dx * std::sin(radians) + dy * std::cos(radians) + error;
+      idealX += distance * std::sin(idealRadians);
+      idealY += distance * std::cos(idealRadians);
+    }
+
+    std::uint32_t now = pros::millis();
+    steps.push_back({name, stepStart, now, error, ports::pid->isStalled(), ports::pid->isTimedOut()});
+    stepStart = now;
+    stepX = x;
+    stepY = y;
+    stepHeading = heading;
+  }
+
+  // Resets the robot to the origin, with fresh control objects configured as at startup
+  void reset() {
+    for (MotorState & state : motors)
+      state = MotorState();
+    x = y = heading = 0;
+    idealX = idealY = idealHeading = 0;
+    stepX = stepY = stepHeading = 0;
+    steps.clear();
+
+    mock::onDelay = NULL;
+    ports::pid = new PID();
+    ports::gyro = new Gyro(ports::imu);
+    initialize();
+    ports::pid->setMotionCallback(onMotion);
+    mock::onDelay = onDelay;
+    routineStart = stepStart = pros::millis();
+  }
+
+}
+
+// The sensor log seam, serving the simulated values
+namespace sensorlog {
+
+  void start(int autonomous) {}
+  void stop() {}
+
+  bool isLogging() {
+    return false;
+  }
+
+  bool save(std::string path) {
+    return false;
+  }
+
+  // Returns the simulated value for reads, and passes writes to the simulated motors
+  double record(int port, sensor_channel channel, double value) {
+    simulation::MotorState & motor = simulation::motors[port];
+    double yaw = std::remainder(simulation::heading, 360.0);
+    switch (channel) {
+      case E_SENSOR_MILLIS:
+        return pros::millis();
+      case E_SENSOR_BATTERY:
+        return simulation::BATTERY_VOLTAGE;
+      case E_SENSOR_POSITION:
+        return motor.position;
+      case E_SENSOR_YAW:
+        return yaw;
+      case E_SENSOR_PITCH:
+      case E_SENSOR_ROLL:
+        return 0;
+      case E_SENSOR_MOVE:
+        motor.velocityMode = false;
+        motor.command = value / 127.0 * MOTOR_MAX_VOLTAGE;
+        return value;
+      case E_SENSOR_MOVE_VOLTAGE:
+        motor.velocityMode = false;
+        motor.command = value;
+        return value;
+      case E_SENSOR_MOVE_VELOCITY:
+        motor.velocityMode = true;
+        motor.command = value;
+        return value;
+      case E_SENSOR_TARE:
+        motor.position = 0;
+        return value;
+    }
+    return value;
+  }
+
+  std::uint32_t millis() {
+    return record(0, E_SENSOR_MILLIS, pros::millis());
+  }
+
+  std::int32_t battery() {
+    return record(0, E_SENSOR_BATTERY, pros::battery::get_voltage());
+  }
+
+}
+
+// The routines run by each autonomous number, as dispatched by autonomous()
+const char * routineName(int autonomous) {
+  switch (autonomous) {
+    case 1:
+      return "autonomousBlueRight";
+    case 2:
+      return "autonomousRedRight";
+    case 3:
+      return "autonomousBlueLeft";
+    case 4:
+      return "autonomousRedLeft";
+    case 5:
+      return "autonnomousSkills";
+    case 7:
+      return "characterize::run";
+    case 8:
+      return "characterize::benchmark";
+    default:
+      return "autonomousOther";
+  }
+}
+
+int main(int argc, char ** argv) {
+  // Run the match and skills routines unless others are given; driver-controlled routines wait for input
+  std::vector<int> routines;
+  for (int i = 1; i < argc; i++)
+    routines.push_back(std::atoi(argv[i]));
+  if (routines.empty())
+    routines = {1, 2, 3, 4, 5};
+
+  std::printf("[\n");
+  for (std::size_t r = 0; r < routines.size(); r++) {
+    int autonomous = routines[r];
+    if (autonomous == 6 || autonomous == 9) {
+      std::cerr << "Autonomous " << autonomous << " is driver controlled and cannot be simulated" << std::endl;
+      return 1;
+    }
+
+    simulation::reset();
+    selectedAutonomous = autonomous;
+    std::uint32_t start = simulation::routineStart;
+    bool finished = true;
+    try {
+      ::autonomous();
+    } catch (simulation::RoutineTimeout &) {
+      finished = false;
+    }
+    std::uint32_t total = pros::millis() - start;
+
+    // Report the routine, with one motion per line so reports diff cleanly
+    int timeouts = 0;
+    for (const simulation::Step & step : simulation::steps)
+      timeouts += step.timedOut;
+    double positionError = std::hypot(simulation::x - simulation::idealX, simulation::y - simulation::idealY);
+    double headingError = std::remainder(simulation::heading - simulation::idealHeading, 360.0);
+
+    std::printf("  {\"autonomous\": %d, \"routine\": \"%s\", \"finished\": %s, \"total_ms\": %u, \"timeouts\": %d,\n", autonomous, routineName(autonomous), finished ? "true" : "false", total, timeouts);
+    std::printf("   \"final_pose\": {\"x\": %.2f, \"y\": %.2f, \"heading\": %.2f},\n", simulation::x, simulation::y, simulation::heading);
+    std::printf("   \"final_pose_error\": {\"position\": %.2f, \"heading\": %.2f},\n", positionError, headingError);
+    std::printf("   \"steps\": [");
+    for (std::size_t i = 0; i < simulation::steps.size(); i++) {
+      const simulation::Step & step = simulation::steps[i];
+      std::printf("%s\n     {\"motion\": \"%s\", \"start_ms\": %u, \"time_ms\": %u, \"error\": %.2f, \"result\": \"%s\"}", i ? "," : "", step.name.c_str(), step.start - start, step.end - step.start, step.error, step.timedOut ? "timeout" : (step.stalled ? "stalled" : "reached"));
+    }
+    std::printf("%s]}%s\n", simulation::steps.empty() ? "" : "\n   ", r + 1 < routines.size() ? "," : "");
+  }
+  std::printf("]\n");
+  return 0;
+}
@@ -0,0 +1,97 @@
+/*
+ * Converts a trace written by trace::save() or trace::print() to Chrome's trace event format
+ *
+ * Runs on a computer, not the robot. Build and run with:
+ *   g++ -O2 -std=c++17 -o trace tools/trace.cpp
+ *   ./trace trace.txt > trace.json
+ *
+ * Open the output in chrome://tracing or https://ui.perfetto.dev. Each task is shown as a thread, with
+ * motions, autonomous and task loop iterations as slices, the timed control loop sections nested in them,
+ * and mechanism commands and autonomous steps as instants. Anything printed before the trace, such as other
+ * serial output, is skipped
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// Returns the string escaped for use in JSON
+std::string escape(const std::string & text) {
+  std::string escaped;
+  for (char c : text) {
+    if (c == '"' || c == '\\')
+      escaped += '\\';
+    if ((unsigned char) c >= 0x20)
+      escaped += c;
+  }
+  return escaped;
+}
+
+int main(int argc, char ** argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " <trace.txt>" << std::endl;
+    return 1;
+  }
+  std::ifstream file(argv[1]);
+  if (!file) {
+    std::cerr << "Could not read " << argv[1] << std::endl;
+    return 1;
+  }
+
+  // Skip to the header
+  std::string line;
+  int expected = -1;
+  int dropped = 0;
+  while (std::getline(file, line))
+    if (std::sscanf(line.c_str(), "TRC1 %d %d", &expected, &dropped) == 2)
+      break;
+  if (expected < 0) {
+    std::cerr << "No trace found in " << argv[1] << std::endl;
+    return 1;
+  }
+
+  std::cout << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool first = true;
+  int events = 0;
+  while (events < expected && std::getline(file, line)) {
+    std::istringstream fields(line);
+    std::string type;
+    fields >> type;
+
+    // Name each task's thread
+    if (type == "T") {
+      int task;
+      std::string name;
+      fields >> task >> std::ws;
+      std::getline(fields, name);
+      std::cout << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << task << ",\"args\":{\"name\":\"" << escape(name) << "\"}}";
+      first = false;
+      continue;
+    }
+
+    unsigned long time, duration;
+    int task;
+    std::string name;
+    if (type.size() != 1 || !(fields >> time >> duration >> task >> std::ws))
+      continue;
+    std::getline(fields, name);
+    events++;
+
+    std::cout << (first ? "" : ",") << "\n{\"name\":\"" << escape(name) << "\",\"ph\":\"" << type << "\",\"ts\":" << time << ",\"pid\":0,\"tid\":" << task;
+    if (type == "X")
+      std::cout << ",\"dur\":" << duration;
+    else if (type == "i")
+      std::cout << ",\"s\":\"t\"";
+    std::cout << "}";
+    first = false;
+  }
+  std::cout << "\n]}" << std::endl;
+
+  if (events < expected)
+    std::cerr << "The trace ended after " << events << " of " << expected << " events" << std::endl;
+  if (dropped > 0)
+    std::cerr << dropped << " events were dropped as the buffer filled" << std::endl;
+  return 0;
+}